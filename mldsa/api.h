@@ -8,20 +8,82 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#if defined(MLD_CONFIG_SIGN_STATS)
+/*
+ * Statistics of the rejection loop of signing, kept per thread. Only
+ * provided with MLD_CONFIG_SIGN_STATS, see config.h.
+ */
+#include "sign_stats.h"
+#endif /* MLD_CONFIG_SIGN_STATS */
+
 #define MLD_44_PUBLICKEYBYTES 1312
 #define MLD_44_SECRETKEYBYTES 2560
+#define MLD_44_SIGNCTXBYTES 2768
+#define MLD_44_VERIFYCTXBYTES 1520
 #define MLD_44_BYTES 2420
+/* The following sizes depend on MLD_CONFIG_REDUCE_RAM, see config.h */
+#if !defined(MLD_CONFIG_REDUCE_RAM)
+#define MLD_44_EXPANDEDSKBYTES 29128
+#define MLD_44_EXPANDEDPKBYTES 20688
+#define MLD_44_WORKSPACEBYTES 50632
+#else  /* !MLD_CONFIG_REDUCE_RAM */
+#define MLD_44_EXPANDEDSKBYTES 12776
+#define MLD_44_EXPANDEDPKBYTES 4336
+#define MLD_44_WORKSPACEBYTES 34280
+#endif /* MLD_CONFIG_REDUCE_RAM */
 
 #define MLD_44_ref_PUBLICKEYBYTES MLD_44_PUBLICKEYBYTES
 #define MLD_44_ref_SECRETKEYBYTES MLD_44_SECRETKEYBYTES
+#define MLD_44_ref_EXPANDEDSKBYTES MLD_44_EXPANDEDSKBYTES
+#define MLD_44_ref_EXPANDEDPKBYTES MLD_44_EXPANDEDPKBYTES
+#define MLD_44_ref_SIGNCTXBYTES MLD_44_SIGNCTXBYTES
+#define MLD_44_ref_VERIFYCTXBYTES MLD_44_VERIFYCTXBYTES
+#define MLD_44_ref_WORKSPACEBYTES MLD_44_WORKSPACEBYTES
 #define MLD_44_ref_BYTES MLD_44_BYTES
 
+/* Opaque expanded secret key of at most MLD_44_EXPANDEDSKBYTES bytes */
+struct MLD_44_ref_expanded_sk;
+/* Opaque expanded public key of at most MLD_44_EXPANDEDPKBYTES bytes */
+struct MLD_44_ref_expanded_pk;
+/* Opaque incremental signing state of at most MLD_44_SIGNCTXBYTES bytes */
+struct MLD_44_ref_sign_ctx;
+/* Opaque incremental verify state of at most MLD_44_VERIFYCTXBYTES bytes */
+struct MLD_44_ref_verify_ctx;
+/* Opaque workspace of at most MLD_44_WORKSPACEBYTES bytes, aligned for
+ * uint64_t */
+struct MLD_44_ref_workspace;
+
 int MLD_44_ref_keypair(uint8_t *pk, uint8_t *sk);
 
+int MLD_44_ref_keypair_ws(uint8_t *pk, uint8_t *sk,
+                          struct MLD_44_ref_workspace *ws);
+
 int MLD_44_ref_signature(uint8_t *sig, size_t *siglen, const uint8_t *m,
                          size_t mlen, const uint8_t *ctx, size_t ctxlen,
                          const uint8_t *sk);
 
+int MLD_44_ref_signature_ws(uint8_t *sig, size_t *siglen, const uint8_t *m,
+                            size_t mlen, const uint8_t *ctx, size_t ctxlen,
+                            const uint8_t *sk,
+                            struct MLD_44_ref_workspace *ws);
+
+int MLD_44_ref_expand_sk(struct MLD_44_ref_expanded_sk *esk,
+                         const uint8_t *sk);
+
+int MLD_44_ref_signature_expanded(uint8_t *sig, size_t *siglen,
+                                  const uint8_t *m, size_t mlen,
+                                  const uint8_t *ctx, size_t ctxlen,
+                                  const struct MLD_44_ref_expanded_sk *esk);
+
+int MLD_44_ref_sign_init(struct MLD_44_ref_sign_ctx *sctx, const uint8_t *sk,
+                         const uint8_t *ctx, size_t ctxlen);
+
+int MLD_44_ref_sign_update(struct MLD_44_ref_sign_ctx *sctx, const uint8_t *m,
+                           size_t mlen);
+
+int MLD_44_ref_sign_final(struct MLD_44_ref_sign_ctx *sctx, uint8_t *sig,
+                          size_t *siglen);
+
 int MLD_44_ref(uint8_t *sm, size_t *smlen, const uint8_t *m, size_t mlen,
                const uint8_t *ctx, size_t ctxlen, const uint8_t *sk);
 
@@ -29,23 +91,110 @@ int MLD_44_ref_verify(const uint8_t *sig, size_t siglen, const uint8_t *m,
                       size_t mlen, const uint8_t *ctx, size_t ctxlen,
                       const uint8_t *pk);
 
+int MLD_44_ref_verify_ws(const uint8_t *sig, size_t siglen, const uint8_t *m,
+                         size_t mlen, const uint8_t *ctx, size_t ctxlen,
+                         const uint8_t *pk, struct MLD_44_ref_workspace *ws);
+
+int MLD_44_ref_expand_pk(struct MLD_44_ref_expanded_pk *epk,
+                         const uint8_t *pk);
+
+int MLD_44_ref_verify_expanded(const uint8_t *sig, size_t siglen,
+                               const uint8_t *m, size_t mlen,
+                               const uint8_t *ctx, size_t ctxlen,
+                               const struct MLD_44_ref_expanded_pk *epk);
+
+int MLD_44_ref_verify_batch(const uint8_t *const *sigs, const size_t *siglens,
+                            const uint8_t *const *ms, const size_t *mlens,
+                            size_t n, const uint8_t *ctx, size_t ctxlen,
+                            const uint8_t *pk, int *results);
+
+int MLD_44_ref_verify_init(struct MLD_44_ref_verify_ctx *vctx,
+                           const uint8_t *pk, const uint8_t *ctx,
+                           size_t ctxlen);
+
+int MLD_44_ref_verify_update(struct MLD_44_ref_verify_ctx *vctx,
+                             const uint8_t *m, size_t mlen);
+
+int MLD_44_ref_verify_final(struct MLD_44_ref_verify_ctx *vctx,
+                            const uint8_t *sig, size_t siglen);
+
 int MLD_44_ref_open(uint8_t *m, size_t *mlen, const uint8_t *sm, size_t smlen,
                     const uint8_t *ctx, size_t ctxlen, const uint8_t *pk);
 
+#if defined(MLD_CONFIG_SIGN_STATS)
+void MLD_44_ref_sign_stats(struct MLD_ref_sign_stats *stats);
+
+void MLD_44_ref_sign_stats_reset(void);
+#endif /* MLD_CONFIG_SIGN_STATS */
+
 #define MLD_65_PUBLICKEYBYTES 1952
 #define MLD_65_SECRETKEYBYTES 4032
+#define MLD_65_SIGNCTXBYTES 4240
+#define MLD_65_VERIFYCTXBYTES 2160
 #define MLD_65_BYTES 3309
+/* The following sizes depend on MLD_CONFIG_REDUCE_RAM, see config.h */
+#if !defined(MLD_CONFIG_REDUCE_RAM)
+#define MLD_65_EXPANDEDSKBYTES 48584
+#define MLD_65_EXPANDEDPKBYTES 37072
+#define MLD_65_WORKSPACEBYTES 78280
+#else  /* !MLD_CONFIG_REDUCE_RAM */
+#define MLD_65_EXPANDEDSKBYTES 17896
+#define MLD_65_EXPANDEDPKBYTES 6384
+#define MLD_65_WORKSPACEBYTES 47592
+#endif /* MLD_CONFIG_REDUCE_RAM */
 
 #define MLD_65_ref_PUBLICKEYBYTES MLD_65_PUBLICKEYBYTES
 #define MLD_65_ref_SECRETKEYBYTES MLD_65_SECRETKEYBYTES
+#define MLD_65_ref_EXPANDEDSKBYTES MLD_65_EXPANDEDSKBYTES
+#define MLD_65_ref_EXPANDEDPKBYTES MLD_65_EXPANDEDPKBYTES
+#define MLD_65_ref_SIGNCTXBYTES MLD_65_SIGNCTXBYTES
+#define MLD_65_ref_VERIFYCTXBYTES MLD_65_VERIFYCTXBYTES
+#define MLD_65_ref_WORKSPACEBYTES MLD_65_WORKSPACEBYTES
 #define MLD_65_ref_BYTES MLD_65_BYTES
 
+/* Opaque expanded secret key of at most MLD_65_EXPANDEDSKBYTES bytes */
+struct MLD_65_ref_expanded_sk;
+/* Opaque expanded public key of at most MLD_65_EXPANDEDPKBYTES bytes */
+struct MLD_65_ref_expanded_pk;
+/* Opaque incremental signing state of at most MLD_65_SIGNCTXBYTES bytes */
+struct MLD_65_ref_sign_ctx;
+/* Opaque incremental verify state of at most MLD_65_VERIFYCTXBYTES bytes */
+struct MLD_65_ref_verify_ctx;
+/* Opaque workspace of at most MLD_65_WORKSPACEBYTES bytes, aligned for
+ * uint64_t */
+struct MLD_65_ref_workspace;
+
 int MLD_65_ref_keypair(uint8_t *pk, uint8_t *sk);
 
+int MLD_65_ref_keypair_ws(uint8_t *pk, uint8_t *sk,
+                          struct MLD_65_ref_workspace *ws);
+
 int MLD_65_ref_signature(uint8_t *sig, size_t *siglen, const uint8_t *m,
                          size_t mlen, const uint8_t *ctx, size_t ctxlen,
                          const uint8_t *sk);
 
+int MLD_65_ref_signature_ws(uint8_t *sig, size_t *siglen, const uint8_t *m,
+                            size_t mlen, const uint8_t *ctx, size_t ctxlen,
+                            const uint8_t *sk,
+                            struct MLD_65_ref_workspace *ws);
+
+int MLD_65_ref_expand_sk(struct MLD_65_ref_expanded_sk *esk,
+                         const uint8_t *sk);
+
+int MLD_65_ref_signature_expanded(uint8_t *sig, size_t *siglen,
+                                  const uint8_t *m, size_t mlen,
+                                  const uint8_t *ctx, size_t ctxlen,
+                                  const struct MLD_65_ref_expanded_sk *esk);
+
+int MLD_65_ref_sign_init(struct MLD_65_ref_sign_ctx *sctx, const uint8_t *sk,
+                         const uint8_t *ctx, size_t ctxlen);
+
+int MLD_65_ref_sign_update(struct MLD_65_ref_sign_ctx *sctx, const uint8_t *m,
+                           size_t mlen);
+
+int MLD_65_ref_sign_final(struct MLD_65_ref_sign_ctx *sctx, uint8_t *sig,
+                          size_t *siglen);
+
 int MLD_65_ref(uint8_t *sm, size_t *smlen, const uint8_t *m, size_t mlen,
                const uint8_t *ctx, size_t ctxlen, const uint8_t *sk);
 
@@ -53,23 +202,110 @@ int MLD_65_ref_verify(const uint8_t *sig, size_t siglen, const uint8_t *m,
                       size_t mlen, const uint8_t *ctx, size_t ctxlen,
                       const uint8_t *pk);
 
+int MLD_65_ref_verify_ws(const uint8_t *sig, size_t siglen, const uint8_t *m,
+                         size_t mlen, const uint8_t *ctx, size_t ctxlen,
+                         const uint8_t *pk, struct MLD_65_ref_workspace *ws);
+
+int MLD_65_ref_expand_pk(struct MLD_65_ref_expanded_pk *epk,
+                         const uint8_t *pk);
+
+int MLD_65_ref_verify_expanded(const uint8_t *sig, size_t siglen,
+                               const uint8_t *m, size_t mlen,
+                               const uint8_t *ctx, size_t ctxlen,
+                               const struct MLD_65_ref_expanded_pk *epk);
+
+int MLD_65_ref_verify_batch(const uint8_t *const *sigs, const size_t *siglens,
+                            const uint8_t *const *ms, const size_t *mlens,
+                            size_t n, const uint8_t *ctx, size_t ctxlen,
+                            const uint8_t *pk, int *results);
+
+int MLD_65_ref_verify_init(struct MLD_65_ref_verify_ctx *vctx,
+                           const uint8_t *pk, const uint8_t *ctx,
+                           size_t ctxlen);
+
+int MLD_65_ref_verify_update(struct MLD_65_ref_verify_ctx *vctx,
+                             const uint8_t *m, size_t mlen);
+
+int MLD_65_ref_verify_final(struct MLD_65_ref_verify_ctx *vctx,
+                            const uint8_t *sig, size_t siglen);
+
 int MLD_65_ref_open(uint8_t *m, size_t *mlen, const uint8_t *sm, size_t smlen,
                     const uint8_t *ctx, size_t ctxlen, const uint8_t *pk);
 
+#if defined(MLD_CONFIG_SIGN_STATS)
+void MLD_65_ref_sign_stats(struct MLD_ref_sign_stats *stats);
+
+void MLD_65_ref_sign_stats_reset(void);
+#endif /* MLD_CONFIG_SIGN_STATS */
+
 #define MLD_87_PUBLICKEYBYTES 2592
 #define MLD_87_SECRETKEYBYTES 4896
+#define MLD_87_SIGNCTXBYTES 5104
+#define MLD_87_VERIFYCTXBYTES 2800
 #define MLD_87_BYTES 4627
+/* The following sizes depend on MLD_CONFIG_REDUCE_RAM, see config.h */
+#if !defined(MLD_CONFIG_REDUCE_RAM)
+#define MLD_87_EXPANDEDSKBYTES 81352
+#define MLD_87_EXPANDEDPKBYTES 65744
+#define MLD_87_WORKSPACEBYTES 121288
+#else  /* !MLD_CONFIG_REDUCE_RAM */
+#define MLD_87_EXPANDEDSKBYTES 24040
+#define MLD_87_EXPANDEDPKBYTES 8432
+#define MLD_87_WORKSPACEBYTES 63976
+#endif /* MLD_CONFIG_REDUCE_RAM */
 
 #define MLD_87_ref_PUBLICKEYBYTES MLD_87_PUBLICKEYBYTES
 #define MLD_87_ref_SECRETKEYBYTES MLD_87_SECRETKEYBYTES
+#define MLD_87_ref_EXPANDEDSKBYTES MLD_87_EXPANDEDSKBYTES
+#define MLD_87_ref_EXPANDEDPKBYTES MLD_87_EXPANDEDPKBYTES
+#define MLD_87_ref_SIGNCTXBYTES MLD_87_SIGNCTXBYTES
+#define MLD_87_ref_VERIFYCTXBYTES MLD_87_VERIFYCTXBYTES
+#define MLD_87_ref_WORKSPACEBYTES MLD_87_WORKSPACEBYTES
 #define MLD_87_ref_BYTES MLD_87_BYTES
 
+/* Opaque expanded secret key of at most MLD_87_EXPANDEDSKBYTES bytes */
+struct MLD_87_ref_expanded_sk;
+/* Opaque expanded public key of at most MLD_87_EXPANDEDPKBYTES bytes */
+struct MLD_87_ref_expanded_pk;
+/* Opaque incremental signing state of at most MLD_87_SIGNCTXBYTES bytes */
+struct MLD_87_ref_sign_ctx;
+/* Opaque incremental verify state of at most MLD_87_VERIFYCTXBYTES bytes */
+struct MLD_87_ref_verify_ctx;
+/* Opaque workspace of at most MLD_87_WORKSPACEBYTES bytes, aligned for
+ * uint64_t */
+struct MLD_87_ref_workspace;
+
 int MLD_87_ref_keypair(uint8_t *pk, uint8_t *sk);
 
+int MLD_87_ref_keypair_ws(uint8_t *pk, uint8_t *sk,
+                          struct MLD_87_ref_workspace *ws);
+
 int MLD_87_ref_signature(uint8_t *sig, size_t *siglen, const uint8_t *m,
                          size_t mlen, const uint8_t *ctx, size_t ctxlen,
                          const uint8_t *sk);
 
+int MLD_87_ref_signature_ws(uint8_t *sig, size_t *siglen, const uint8_t *m,
+                            size_t mlen, const uint8_t *ctx, size_t ctxlen,
+                            const uint8_t *sk,
+                            struct MLD_87_ref_workspace *ws);
+
+int MLD_87_ref_expand_sk(struct MLD_87_ref_expanded_sk *esk,
+                         const uint8_t *sk);
+
+int MLD_87_ref_signature_expanded(uint8_t *sig, size_t *siglen,
+                                  const uint8_t *m, size_t mlen,
+                                  const uint8_t *ctx, size_t ctxlen,
+                                  const struct MLD_87_ref_expanded_sk *esk);
+
+int MLD_87_ref_sign_init(struct MLD_87_ref_sign_ctx *sctx, const uint8_t *sk,
+                         const uint8_t *ctx, size_t ctxlen);
+
+int MLD_87_ref_sign_update(struct MLD_87_ref_sign_ctx *sctx, const uint8_t *m,
+                           size_t mlen);
+
+int MLD_87_ref_sign_final(struct MLD_87_ref_sign_ctx *sctx, uint8_t *sig,
+                          size_t *siglen);
+
 int MLD_87_ref(uint8_t *sm, size_t *smlen, const uint8_t *m, size_t mlen,
                const uint8_t *ctx, size_t ctxlen, const uint8_t *sk);
 
@@ -77,36 +313,225 @@ int MLD_87_ref_verify(const uint8_t *sig, size_t siglen, const uint8_t *m,
                       size_t mlen, const uint8_t *ctx, size_t ctxlen,
                       const uint8_t *pk);
 
+int MLD_87_ref_verify_ws(const uint8_t *sig, size_t siglen, const uint8_t *m,
+                         size_t mlen, const uint8_t *ctx, size_t ctxlen,
+                         const uint8_t *pk, struct MLD_87_ref_workspace *ws);
+
+int MLD_87_ref_expand_pk(struct MLD_87_ref_expanded_pk *epk,
+                         const uint8_t *pk);
+
+int MLD_87_ref_verify_expanded(const uint8_t *sig, size_t siglen,
+                               const uint8_t *m, size_t mlen,
+                               const uint8_t *ctx, size_t ctxlen,
+                               const struct MLD_87_ref_expanded_pk *epk);
+
+int MLD_87_ref_verify_batch(const uint8_t *const *sigs, const size_t *siglens,
+                            const uint8_t *const *ms, const size_t *mlens,
+                            size_t n, const uint8_t *ctx, size_t ctxlen,
+                            const uint8_t *pk, int *results);
+
+int MLD_87_ref_verify_init(struct MLD_87_ref_verify_ctx *vctx,
+                           const uint8_t *pk, const uint8_t *ctx,
+                           size_t ctxlen);
+
+int MLD_87_ref_verify_update(struct MLD_87_ref_verify_ctx *vctx,
+                             const uint8_t *m, size_t mlen);
+
+int MLD_87_ref_verify_final(struct MLD_87_ref_verify_ctx *vctx,
+                            const uint8_t *sig, size_t siglen);
+
 int MLD_87_ref_open(uint8_t *m, size_t *mlen, const uint8_t *sm, size_t smlen,
                     const uint8_t *ctx, size_t ctxlen, const uint8_t *pk);
 
+#if defined(MLD_CONFIG_SIGN_STATS)
+void MLD_87_ref_sign_stats(struct MLD_ref_sign_stats *stats);
+
+void MLD_87_ref_sign_stats_reset(void);
+#endif /* MLD_CONFIG_SIGN_STATS */
+
+/*
+ * Unified interface over all parameter sets
+ *
+ * Only provided by the combined library (libmldsa.a), which links the
+ * ML-DSA-44, ML-DSA-65 and ML-DSA-87 builds together. Keys and signatures
+ * are handles tagged with their parameter set, sized for the largest one;
+ * the first MLD_ref_{publickey,secretkey,signature}bytes(level) bytes of
+ * `bytes` hold the encoding. Functions return 0 on success and -1 on
+ * failure, including unknown levels and mismatched handles.
+ */
+#define MLD_LEVEL_44 44
+#define MLD_LEVEL_65 65
+#define MLD_LEVEL_87 87
+
+struct MLD_ref_public_key
+{
+  int level;
+  uint8_t bytes[MLD_87_PUBLICKEYBYTES];
+};
+
+struct MLD_ref_secret_key
+{
+  int level;
+  uint8_t bytes[MLD_87_SECRETKEYBYTES];
+};
+
+struct MLD_ref_signature
+{
+  int level;
+  size_t len;
+  uint8_t bytes[MLD_87_BYTES];
+};
+
+/* Encoding sizes of the given level, or 0 if the level is unknown */
+size_t MLD_ref_publickeybytes(int level);
+size_t MLD_ref_secretkeybytes(int level);
+size_t MLD_ref_signaturebytes(int level);
+
+int MLD_ref_keypair(int level, struct MLD_ref_public_key *pk,
+                    struct MLD_ref_secret_key *sk);
+
+/* Wrap an encoded key or signature received for the given level */
+int MLD_ref_import_pk(struct MLD_ref_public_key *pk, int level,
+                      const uint8_t *buf, size_t buflen);
+int MLD_ref_import_sk(struct MLD_ref_secret_key *sk, int level,
+                      const uint8_t *buf, size_t buflen);
+int MLD_ref_import_sig(struct MLD_ref_signature *sig, int level,
+                       const uint8_t *buf, size_t buflen);
+
+/* Signs at the level of sk; sig is tagged with the same level */
+int MLD_ref_sign(struct MLD_ref_signature *sig, const uint8_t *m, size_t mlen,
+                 const uint8_t *ctx, size_t ctxlen,
+                 const struct MLD_ref_secret_key *sk);
+
+/* Fails if sig and pk are tagged with different levels */
+int MLD_ref_verify(const struct MLD_ref_signature *sig, const uint8_t *m,
+                   size_t mlen, const uint8_t *ctx, size_t ctxlen,
+                   const struct MLD_ref_public_key *pk);
+
+#define mld_public_key MLD_ref_public_key
+#define mld_secret_key MLD_ref_secret_key
+#define mld_signature MLD_ref_signature
+#define mld_publickeybytes MLD_ref_publickeybytes
+#define mld_secretkeybytes MLD_ref_secretkeybytes
+#define mld_signaturebytes MLD_ref_signaturebytes
+#define mld_keypair MLD_ref_keypair
+#define mld_import_pk MLD_ref_import_pk
+#define mld_import_sk MLD_ref_import_sk
+#define mld_import_sig MLD_ref_import_sig
+#define mld_sign MLD_ref_sign
+#define mld_verify MLD_ref_verify
+
 #if MLDSA_MODE == 2
 #define CRYPTO_PUBLICKEYBYTES MLD_44_PUBLICKEYBYTES
 #define CRYPTO_SECRETKEYBYTES MLD_44_SECRETKEYBYTES
+#define CRYPTO_EXPANDEDSKBYTES MLD_44_EXPANDEDSKBYTES
+#define CRYPTO_EXPANDEDPKBYTES MLD_44_EXPANDEDPKBYTES
+#define CRYPTO_SIGNCTXBYTES MLD_44_SIGNCTXBYTES
+#define CRYPTO_VERIFYCTXBYTES MLD_44_VERIFYCTXBYTES
+#define CRYPTO_WORKSPACEBYTES MLD_44_WORKSPACEBYTES
 #define CRYPTO_BYTES MLD_44_BYTES
+#define crypto_sign_expanded_sk MLD_44_ref_expanded_sk
+#define crypto_sign_expanded_pk MLD_44_ref_expanded_pk
+#define crypto_sign_ctx MLD_44_ref_sign_ctx
+#define crypto_verify_ctx MLD_44_ref_verify_ctx
+#define crypto_sign_workspace MLD_44_ref_workspace
 #define crypto_sign_keypair MLD_44_ref_keypair
+#define crypto_sign_keypair_ws MLD_44_ref_keypair_ws
 #define crypto_sign_signature MLD_44_ref_signature
+#define crypto_sign_signature_ws MLD_44_ref_signature_ws
+#define crypto_sign_expand_sk MLD_44_ref_expand_sk
+#define crypto_sign_signature_expanded MLD_44_ref_signature_expanded
+#define crypto_sign_init MLD_44_ref_sign_init
+#define crypto_sign_update MLD_44_ref_sign_update
+#define crypto_sign_final MLD_44_ref_sign_final
 #define crypto_sign MLD_44_ref
 #define crypto_sign_verify MLD_44_ref_verify
+#define crypto_sign_verify_ws MLD_44_ref_verify_ws
+#define crypto_sign_expand_pk MLD_44_ref_expand_pk
+#define crypto_sign_verify_expanded MLD_44_ref_verify_expanded
+#define crypto_sign_verify_batch MLD_44_ref_verify_batch
+#define crypto_verify_init MLD_44_ref_verify_init
+#define crypto_verify_update MLD_44_ref_verify_update
+#define crypto_verify_final MLD_44_ref_verify_final
 #define crypto_sign_open MLD_44_ref_open
+#if defined(MLD_CONFIG_SIGN_STATS)
+#define crypto_sign_stats MLD_44_ref_sign_stats
+#define crypto_sign_stats_reset MLD_44_ref_sign_stats_reset
+#endif /* MLD_CONFIG_SIGN_STATS */
 #elif MLDSA_MODE == 3
 #define CRYPTO_PUBLICKEYBYTES MLD_65_PUBLICKEYBYTES
 #define CRYPTO_SECRETKEYBYTES MLD_65_SECRETKEYBYTES
+#define CRYPTO_EXPANDEDSKBYTES MLD_65_EXPANDEDSKBYTES
+#define CRYPTO_EXPANDEDPKBYTES MLD_65_EXPANDEDPKBYTES
+#define CRYPTO_SIGNCTXBYTES MLD_65_SIGNCTXBYTES
+#define CRYPTO_VERIFYCTXBYTES MLD_65_VERIFYCTXBYTES
+#define CRYPTO_WORKSPACEBYTES MLD_65_WORKSPACEBYTES
 #define CRYPTO_BYTES MLD_65_BYTES
+#define crypto_sign_expanded_sk MLD_65_ref_expanded_sk
+#define crypto_sign_expanded_pk MLD_65_ref_expanded_pk
+#define crypto_sign_ctx MLD_65_ref_sign_ctx
+#define crypto_verify_ctx MLD_65_ref_verify_ctx
+#define crypto_sign_workspace MLD_65_ref_workspace
 #define crypto_sign_keypair MLD_65_ref_keypair
+#define crypto_sign_keypair_ws MLD_65_ref_keypair_ws
 #define crypto_sign_signature MLD_65_ref_signature
+#define crypto_sign_signature_ws MLD_65_ref_signature_ws
+#define crypto_sign_expand_sk MLD_65_ref_expand_sk
+#define crypto_sign_signature_expanded MLD_65_ref_signature_expanded
+#define crypto_sign_init MLD_65_ref_sign_init
+#define crypto_sign_update MLD_65_ref_sign_update
+#define crypto_sign_final MLD_65_ref_sign_final
 #define crypto_sign MLD_65_ref
 #define crypto_sign_verify MLD_65_ref_verify
+#define crypto_sign_verify_ws MLD_65_ref_verify_ws
+#define crypto_sign_expand_pk MLD_65_ref_expand_pk
+#define crypto_sign_verify_expanded MLD_65_ref_verify_expanded
+#define crypto_sign_verify_batch MLD_65_ref_verify_batch
+#define crypto_verify_init MLD_65_ref_verify_init
+#define crypto_verify_update MLD_65_ref_verify_update
+#define crypto_verify_final MLD_65_ref_verify_final
 #define crypto_sign_open MLD_65_ref_open
+#if defined(MLD_CONFIG_SIGN_STATS)
+#define crypto_sign_stats MLD_65_ref_sign_stats
+#define crypto_sign_stats_reset MLD_65_ref_sign_stats_reset
+#endif /* MLD_CONFIG_SIGN_STATS */
 #elif MLDSA_MODE == 5
 #define CRYPTO_PUBLICKEYBYTES MLD_87_PUBLICKEYBYTES
 #define CRYPTO_SECRETKEYBYTES MLD_87_SECRETKEYBYTES
+#define CRYPTO_EXPANDEDSKBYTES MLD_87_EXPANDEDSKBYTES
+#define CRYPTO_EXPANDEDPKBYTES MLD_87_EXPANDEDPKBYTES
+#define CRYPTO_SIGNCTXBYTES MLD_87_SIGNCTXBYTES
+#define CRYPTO_VERIFYCTXBYTES MLD_87_VERIFYCTXBYTES
+#define CRYPTO_WORKSPACEBYTES MLD_87_WORKSPACEBYTES
 #define CRYPTO_BYTES MLD_87_BYTES
+#define crypto_sign_expanded_sk MLD_87_ref_expanded_sk
+#define crypto_sign_expanded_pk MLD_87_ref_expanded_pk
+#define crypto_sign_ctx MLD_87_ref_sign_ctx
+#define crypto_verify_ctx MLD_87_ref_verify_ctx
+#define crypto_sign_workspace MLD_87_ref_workspace
 #define crypto_sign_keypair MLD_87_ref_keypair
+#define crypto_sign_keypair_ws MLD_87_ref_keypair_ws
 #define crypto_sign_signature MLD_87_ref_signature
+#define crypto_sign_signature_ws MLD_87_ref_signature_ws
+#define crypto_sign_expand_sk MLD_87_ref_expand_sk
+#define crypto_sign_signature_expanded MLD_87_ref_signature_expanded
+#define crypto_sign_init MLD_87_ref_sign_init
+#define crypto_sign_update MLD_87_ref_sign_update
+#define crypto_sign_final MLD_87_ref_sign_final
 #define crypto_sign MLD_87_ref
 #define crypto_sign_verify MLD_87_ref_verify
+#define crypto_sign_verify_ws MLD_87_ref_verify_ws
+#define crypto_sign_expand_pk MLD_87_ref_expand_pk
+#define crypto_sign_verify_expanded MLD_87_ref_verify_expanded
+#define crypto_sign_verify_batch MLD_87_ref_verify_batch
+#define crypto_verify_init MLD_87_ref_verify_init
+#define crypto_verify_update MLD_87_ref_verify_update
+#define crypto_verify_final MLD_87_ref_verify_final
 #define crypto_sign_open MLD_87_ref_open
+#if defined(MLD_CONFIG_SIGN_STATS)
+#define crypto_sign_stats MLD_87_ref_sign_stats
+#define crypto_sign_stats_reset MLD_87_ref_sign_stats_reset
+#endif /* MLD_CONFIG_SIGN_STATS */
 #endif /* MLDSA_MODE == 5 */
 
 
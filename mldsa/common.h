@@ -9,4 +9,8 @@
 #include "params.h"
 #include "sys.h"
 
+#if defined(MLD_CONFIG_USE_NATIVE_BACKEND_ARITH)
+#include "native/auto.h"
+#endif
+
 #endif /* !MLD_COMMON_H */
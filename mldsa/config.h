@@ -25,4 +25,155 @@
 #define MLD_NAMESPACE(s) MLD_87_ref_##s
 #endif
 
+/* Namespace of the types shared by all parameter sets, see api.h */
+#define MLD_NAMESPACE_SHARED(s) MLD_ref_##s
+
+/******************************************************************************
+ * Name:        MLD_CONFIG_USE_NATIVE_BACKEND_FIPS202
+ *
+ * Description: Determines whether a native FIPS202 backend should be used.
+ *
+ *              If this option is set, the backend matching the target
+ *              architecture is selected in fips202/native/auto.h. Functions
+ *              not provided by the backend fall back to the C
+ *              implementation.
+ *
+ *              This can also be set using CFLAGS.
+ *
+ *****************************************************************************/
+/* #define MLD_CONFIG_USE_NATIVE_BACKEND_FIPS202 */
+
+/******************************************************************************
+ * Name:        MLD_CONFIG_USE_NATIVE_BACKEND_ARITH
+ *
+ * Description: Determines whether a native arithmetic backend should be used.
+ *
+ *              If this option is set, the backend matching the target
+ *              architecture is selected in native/auto.h. Functions not
+ *              provided by the backend fall back to the C implementation.
+ *
+ *              This can also be set using CFLAGS.
+ *
+ *****************************************************************************/
+/* #define MLD_CONFIG_USE_NATIVE_BACKEND_ARITH */
+
+/******************************************************************************
+ * Name:        MLD_CONFIG_NO_RUNTIME_DISPATCH
+ *
+ * Description: By default, on x86_64 with GCC or clang, the AVX2 backends
+ *              are compiled even if the compiler was not told to assume
+ *              AVX2, and are used only if the CPU supports AVX2 at runtime.
+ *              Set this option to restrict the native backends to the
+ *              instruction set extensions enabled at compile time.
+ *
+ *              This is consulted in sys.h, which is shared with the FIPS202
+ *              module, and must therefore be set using CFLAGS.
+ *
+ *****************************************************************************/
+/* #define MLD_CONFIG_NO_RUNTIME_DISPATCH */
+
+/******************************************************************************
+ * Name:        MLD_CONFIG_NO_CAPS_ENV
+ *
+ * Description: If this option is set, mld_init() ignores the environment
+ *              variable MLD_DISABLE_CAPS, which otherwise allows disabling
+ *              native backends at runtime, e.g. to test the C fallbacks:
+ *
+ *                MLD_DISABLE_CAPS=avx2 ./test_mldsa44
+ *
+ *              This must be set using CFLAGS.
+ *
+ *****************************************************************************/
+/* #define MLD_CONFIG_NO_CAPS_ENV */
+
+/******************************************************************************
+ * Name:        MLD_CONFIG_REDUCE_RAM
+ *
+ * Description: If this option is set, the matrix A is never stored in full.
+ *              Expanded keys and the key generation scratch space keep only
+ *              the seed rho, and every matrix entry is sampled right before
+ *              it is used in a matrix-vector product. This saves between
+ *              16 KiB (ML-DSA-44) and 56 KiB (ML-DSA-87) per expanded key,
+ *              at the cost of re-sampling A in every signing attempt and
+ *              verification.
+ *
+ *              This changes the sizes in api.h and must therefore be set
+ *              using CFLAGS.
+ *
+ *****************************************************************************/
+/* #define MLD_CONFIG_REDUCE_RAM */
+
+/******************************************************************************
+ * Name:        MLD_CONFIG_SIGN_THREADS
+ *
+ * Description: If set to a value N > 1, signing evaluates the attempts of
+ *              the rejection loop concurrently on N threads: the calling
+ *              thread and N - 1 POSIX threads created for each signing
+ *              operation. The signature of the accepted attempt with the
+ *              lowest nonce is returned, so signatures are identical to
+ *              those of the serial implementation; only the latency
+ *              changes. This mainly shortens the tail of signing latency,
+ *              which is dominated by signatures requiring many attempts.
+ *
+ *              The _ws variants of signing, which keep all temporaries in
+ *              the caller-provided workspace, remain serial.
+ *
+ *              This requires POSIX threads, e.g. building with -pthread.
+ *              If the lock shared by the threads cannot be initialized,
+ *              signing fails with -1 and returns an empty signature.
+ *
+ *****************************************************************************/
+/* #define MLD_CONFIG_SIGN_THREADS 4 */
+
+/******************************************************************************
+ * Name:        MLD_CONFIG_SIGN_4X
+ *
+ * Description: If this option is set, signing evaluates the attempts of the
+ *              rejection loop speculatively in groups of four: y, w1 and
+ *              the challenge are computed for four consecutive nonces at
+ *              once using 4-way SHAKE256, and the rejection checks are run
+ *              in nonce order until one attempt is accepted. Signatures
+ *              are identical to those of the serial implementation.
+ *
+ *              This keeps the temporaries of four attempts on the stack:
+ *              about 84 KiB for ML-DSA-44, 116 KiB for ML-DSA-65 and
+ *              156 KiB for ML-DSA-87, in addition to the expanded secret
+ *              key (CRYPTO_EXPANDEDSKBYTES) when signing with a bit-packed
+ *              secret key. The _ws variants of signing remain serial and
+ *              keep everything in the workspace; use them where stack is
+ *              scarce.
+ *
+ *              It can be combined with MLD_CONFIG_SIGN_THREADS, in which
+ *              case every thread evaluates groups of four attempts and
+ *              needs the above on its own stack. The threads are created
+ *              with the default stack size of the platform, which must be
+ *              large enough; e.g. the 128 KiB default of musl is not for
+ *              ML-DSA-87.
+ *
+ *****************************************************************************/
+/* #define MLD_CONFIG_SIGN_4X */
+
+/******************************************************************************
+ * Name:        MLD_CONFIG_SIGN_STATS
+ *
+ * Description: If this option is set, signing records statistics of its
+ *              rejection loop: the number of attempts per signing
+ *              operation and, for every rejected attempt, which check
+ *              rejected it. The statistics are kept per thread and read
+ *              with crypto_sign_stats(), see sign.h.
+ *
+ *              This is a diagnostic for benchmarking and testing. Which
+ *              check rejects an attempt is not secret (it is also revealed
+ *              by the timing of signing), but the counters add work to
+ *              every attempt. Without this option, no code is added.
+ *
+ *              With MLD_CONFIG_SIGN_THREADS, the attempts evaluated by all
+ *              threads are counted, including speculative ones beyond the
+ *              accepted attempt.
+ *
+ *              This requires compiler support for thread-local storage.
+ *
+ *****************************************************************************/
+/* #define MLD_CONFIG_SIGN_STATS */
+
 #endif /* !MLD_CONFIG_H */
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <stddef.h>
+#include <stdint.h>
+
+#include "fips202x4.h"
+#include "keccakf1600.h"
+
+/*************************************************
+ * Name:        keccakx4_absorb_once
+ *
+ * Description: Absorb step of Keccak for four parallel instances;
+ *              non-incremental, starts by zeroeing the state.
+ *              All four inputs must have the same length.
+ *
+ * Arguments:   - uint64_t *s: pointer to (uninitialized) output Keccak states
+ *              - unsigned int r: rate in bytes (e.g., 168 for SHAKE128)
+ *              - const uint8_t *in0, ..., *in3: pointers to inputs
+ *              - size_t inlen: length of each input in bytes
+ *              - uint8_t p: domain-separation byte for different Keccak-derived
+ *functions
+ **************************************************/
+static void keccakx4_absorb_once(uint64_t s[KECCAK_LANES * KECCAK_WAY],
+                                 unsigned int r, const uint8_t *in0,
+                                 const uint8_t *in1, const uint8_t *in2,
+                                 const uint8_t *in3, size_t inlen, uint8_t p)
+{
+  unsigned int i;
+
+  for (i = 0; i < KECCAK_LANES * KECCAK_WAY; i++)
+  {
+    s[i] = 0;
+  }
+
+  while (inlen >= r)
+  {
+    for (i = 0; i < r; i++)
+    {
+      s[KECCAK_WAY * (i / 8) + 0] ^= (uint64_t)in0[i] << 8 * (i % 8);
+      s[KECCAK_WAY * (i / 8) + 1] ^= (uint64_t)in1[i] << 8 * (i % 8);
+      s[KECCAK_WAY * (i / 8) + 2] ^= (uint64_t)in2[i] << 8 * (i % 8);
+      s[KECCAK_WAY * (i / 8) + 3] ^= (uint64_t)in3[i] << 8 * (i % 8);
+    }
+    in0 += r;
+    in1 += r;
+    in2 += r;
+    in3 += r;
+    inlen -= r;
+    KeccakF1600x4_StatePermute(s);
+  }
+
+  for (i = 0; i < inlen; i++)
+  {
+    s[KECCAK_WAY * (i / 8) + 0] ^= (uint64_t)in0[i] << 8 * (i % 8);
+    s[KECCAK_WAY * (i / 8) + 1] ^= (uint64_t)in1[i] << 8 * (i % 8);
+    s[KECCAK_WAY * (i / 8) + 2] ^= (uint64_t)in2[i] << 8 * (i % 8);
+    s[KECCAK_WAY * (i / 8) + 3] ^= (uint64_t)in3[i] << 8 * (i % 8);
+  }
+
+  for (i = 0; i < KECCAK_WAY; i++)
+  {
+    s[KECCAK_WAY * (inlen / 8) + i] ^= (uint64_t)p << 8 * (inlen % 8);
+    s[KECCAK_WAY * ((r - 1) / 8) + i] ^= 1ULL << 63;
+  }
+}
+
+/*************************************************
+ * Name:        keccakx4_squeezeblocks
+ *
+ * Description: Squeeze step of Keccak for four parallel instances.
+ *              Squeezes full blocks of r bytes from each instance.
+ *              Modifies the state. Can be called multiple times to keep
+ *              squeezing, i.e., is incremental.
+ *
+ * Arguments:   - uint8_t *out0, ..., *out3: pointers to output blocks
+ *              - size_t nblocks: number of blocks to be squeezed per instance
+ *              - uint64_t *s: pointer to input/output Keccak states
+ *              - unsigned int r: rate in bytes (e.g., 168 for SHAKE128)
+ **************************************************/
+static void keccakx4_squeezeblocks(uint8_t *out0, uint8_t *out1,
+                                   uint8_t *out2, uint8_t *out3,
+                                   size_t nblocks,
+                                   uint64_t s[KECCAK_LANES * KECCAK_WAY],
+                                   unsigned int r)
+{
+  unsigned int i, j;
+
+  while (nblocks)
+  {
+    KeccakF1600x4_StatePermute(s);
+    for (i = 0; i < r / 8; i++)
+    {
+      for (j = 0; j < 8; j++)
+      {
+        out0[8 * i + j] = (uint8_t)(s[KECCAK_WAY * i + 0] >> 8 * j);
+        out1[8 * i + j] = (uint8_t)(s[KECCAK_WAY * i + 1] >> 8 * j);
+        out2[8 * i + j] = (uint8_t)(s[KECCAK_WAY * i + 2] >> 8 * j);
+        out3[8 * i + j] = (uint8_t)(s[KECCAK_WAY * i + 3] >> 8 * j);
+      }
+    }
+    out0 += r;
+    out1 += r;
+    out2 += r;
+    out3 += r;
+    nblocks -= 1;
+  }
+}
+
+/*************************************************
+ * Name:        shake128x4_absorb_once
+ *
+ * Description: Initialize, absorb into and finalize four SHAKE128 XOFs;
+ *non-incremental.
+ *
+ * Arguments:   - keccakx4_state *state: pointer to (uninitialized) output
+ *Keccak states
+ *              - const uint8_t *in0, ..., *in3: pointers to inputs
+ *              - size_t inlen: length of each input in bytes
+ **************************************************/
+void shake128x4_absorb_once(keccakx4_state *state, const uint8_t *in0,
+                            const uint8_t *in1, const uint8_t *in2,
+                            const uint8_t *in3, size_t inlen)
+{
+  keccakx4_absorb_once(state->s, SHAKE128_RATE, in0, in1, in2, in3, inlen,
+                       0x1F);
+}
+
+/*************************************************
+ * Name:        shake128x4_squeezeblocks
+ *
+ * Description: Squeeze step of four SHAKE128 XOFs. Squeezes full blocks of
+ *              SHAKE128_RATE bytes from each instance. Can be called
+ *              multiple times to keep squeezing.
+ *
+ * Arguments:   - uint8_t *out0, ..., *out3: pointers to output blocks
+ *              - size_t nblocks: number of blocks to be squeezed (written to
+ *each output)
+ *              - keccakx4_state *s: pointer to input/output Keccak states
+ **************************************************/
+void shake128x4_squeezeblocks(uint8_t *out0, uint8_t *out1, uint8_t *out2,
+                              uint8_t *out3, size_t nblocks,
+                              keccakx4_state *state)
+{
+  keccakx4_squeezeblocks(out0, out1, out2, out3, nblocks, state->s,
+                         SHAKE128_RATE);
+}
+
+/*************************************************
+ * Name:        shake256x4_absorb_once
+ *
+ * Description: Initialize, absorb into and finalize four SHAKE256 XOFs;
+ *non-incremental.
+ *
+ * Arguments:   - keccakx4_state *state: pointer to (uninitialized) output
+ *Keccak states
+ *              - const uint8_t *in0, ..., *in3: pointers to inputs
+ *              - size_t inlen: length of each input in bytes
+ **************************************************/
+void shake256x4_absorb_once(keccakx4_state *state, const uint8_t *in0,
+                            const uint8_t *in1, const uint8_t *in2,
+                            const uint8_t *in3, size_t inlen)
+{
+  keccakx4_absorb_once(state->s, SHAKE256_RATE, in0, in1, in2, in3, inlen,
+                       0x1F);
+}
+
+/*************************************************
+ * Name:        shake256x4_squeezeblocks
+ *
+ * Description: Squeeze step of four SHAKE256 XOFs. Squeezes full blocks of
+ *              SHAKE256_RATE bytes from each instance. Can be called
+ *              multiple times to keep squeezing.
+ *
+ * Arguments:   - uint8_t *out0, ..., *out3: pointers to output blocks
+ *              - size_t nblocks: number of blocks to be squeezed (written to
+ *each output)
+ *              - keccakx4_state *s: pointer to input/output Keccak states
+ **************************************************/
+void shake256x4_squeezeblocks(uint8_t *out0, uint8_t *out1, uint8_t *out2,
+                              uint8_t *out3, size_t nblocks,
+                              keccakx4_state *state)
+{
+  keccakx4_squeezeblocks(out0, out1, out2, out3, nblocks, state->s,
+                         SHAKE256_RATE);
+}
+
+/*************************************************
+ * Name:        shake256x4_extract
+ *
+ * Description: Copy one of four SHAKE256 instances to a single SHAKE256
+ *              state, e.g. to keep squeezing only that instance after the
+ *              others are no longer needed. Must only be called between
+ *              calls to shake256x4_squeezeblocks; the extracted state
+ *              continues the output stream of the given instance with the
+ *              next block.
+ *
+ * Arguments:   - keccak_state *state: pointer to output Keccak state
+ *              - const keccakx4_state *statex4: pointer to input Keccak states
+ *              - unsigned int lane: index of the instance to extract
+ **************************************************/
+void shake256x4_extract(keccak_state *state, const keccakx4_state *statex4,
+                        unsigned int lane)
+{
+  unsigned int i;
+
+  for (i = 0; i < KECCAK_LANES; i++)
+  {
+    state->s[i] = statex4->s[KECCAK_WAY * i + lane];
+  }
+  state->pos = SHAKE256_RATE;
+}
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MLD_FIPS202_FIPS202X4_H
+#define MLD_FIPS202_FIPS202X4_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "../cbmc.h"
+#include "fips202.h"
+#include "keccakf1600.h"
+
+/* Four Keccak states, lane-interleaved as expected by
+ * KeccakF1600x4_StatePermute */
+typedef struct
+{
+  uint64_t s[KECCAK_LANES * KECCAK_WAY];
+} keccakx4_state;
+
+#define shake128x4_absorb_once FIPS202_NAMESPACE(shake128x4_absorb_once)
+void shake128x4_absorb_once(keccakx4_state *state, const uint8_t *in0,
+                            const uint8_t *in1, const uint8_t *in2,
+                            const uint8_t *in3, size_t inlen);
+#define shake128x4_squeezeblocks FIPS202_NAMESPACE(shake128x4_squeezeblocks)
+void shake128x4_squeezeblocks(uint8_t *out0, uint8_t *out1, uint8_t *out2,
+                              uint8_t *out3, size_t nblocks,
+                              keccakx4_state *state);
+
+#define shake256x4_absorb_once FIPS202_NAMESPACE(shake256x4_absorb_once)
+void shake256x4_absorb_once(keccakx4_state *state, const uint8_t *in0,
+                            const uint8_t *in1, const uint8_t *in2,
+                            const uint8_t *in3, size_t inlen);
+#define shake256x4_squeezeblocks FIPS202_NAMESPACE(shake256x4_squeezeblocks)
+void shake256x4_squeezeblocks(uint8_t *out0, uint8_t *out1, uint8_t *out2,
+                              uint8_t *out3, size_t nblocks,
+                              keccakx4_state *state);
+
+#define shake256x4_extract FIPS202_NAMESPACE(shake256x4_extract)
+void shake256x4_extract(keccak_state *state, const keccakx4_state *statex4,
+                        unsigned int lane);
+
+#endif /* !MLD_FIPS202_FIPS202X4_H */
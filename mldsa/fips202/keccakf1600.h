@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MLD_FIPS202_KECCAKF1600_H
+#define MLD_FIPS202_KECCAKF1600_H
+
+#include <stdint.h>
+#include "../cbmc.h"
+#include "fips202.h"
+
+#define KECCAK_LANES 25
+#define KECCAK_WAY 4
+
+#define KeccakF1600_StatePermute FIPS202_NAMESPACE(KeccakF1600_StatePermute)
+void KeccakF1600_StatePermute(uint64_t state[KECCAK_LANES]);
+
+/*
+ * The 4-way permutation operates on four Keccak states stored
+ * lane-interleaved: lane i of state j is found at index KECCAK_WAY * i + j.
+ * This matches the layout of four 64-bit lanes in a 256-bit vector register.
+ */
+#define KeccakF1600x4_StatePermute \
+  FIPS202_NAMESPACE(KeccakF1600x4_StatePermute)
+void KeccakF1600x4_StatePermute(uint64_t state[KECCAK_LANES * KECCAK_WAY]);
+
+#endif /* !MLD_FIPS202_KECCAKF1600_H */
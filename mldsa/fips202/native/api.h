@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MLD_FIPS202_NATIVE_API_H
+#define MLD_FIPS202_NATIVE_API_H
+/*
+ * FIPS-202 native interface
+ *
+ * This header is primarily for documentation purposes.
+ * It should not be included by backend implementations.
+ *
+ * A FIPS-202 backend is selected via MLD_CONFIG_USE_NATIVE_BACKEND_FIPS202
+ * and signals which functions it provides by defining the corresponding
+ * MLD_USE_FIPS202_XXX_NATIVE macro. Functions which are not provided by
+ * the backend fall back to the portable C implementation.
+ */
+
+#include <stdint.h>
+
+/*
+ * Those functions are meant to be trivial wrappers around
+ * the chosen native implementation. The are static inline
+ * to avoid unnecessary calls.
+ * The macro before each declaration controls whether a native
+ * implementation is present.
+ */
+
+#if defined(MLD_USE_FIPS202_X4_NATIVE)
+/*************************************************
+ * Name:        keccakf1600x4_permute_native
+ *
+ * Description: Apply the Keccak F1600 permutation to four states.
+ *
+ * Arguments:   - uint64_t *state: pointer to four Keccak states of
+ *                                 KECCAK_LANES lanes each, stored
+ *                                 lane-interleaved, i.e. lane i of state j
+ *                                 is at index KECCAK_WAY * i + j.
+ *
+ * Return MLD_NATIVE_FUNC_FALLBACK if the CPU does not support the native
+ * implementation, leaving the state untouched. Otherwise, returns
+ * MLD_NATIVE_FUNC_SUCCESS.
+ **************************************************/
+static MLD_INLINE int keccakf1600x4_permute_native(uint64_t *state);
+#endif /* MLD_USE_FIPS202_X4_NATIVE */
+
+#endif /* !MLD_FIPS202_NATIVE_API_H */
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/*
+ * Based on the CC0 implementation of the 4-way Keccak-p[1600] permutation
+ * for AVX2 in the eXtended Keccak Code Package (XKCP)
+ * https://github.com/XKCP/XKCP by Gilles Van Assche, Joan Daemen, Michaël
+ * Peeters, Guido Bertoni, Ronny Van Keer and Seth Hoffert.
+ *
+ * The round structure mirrors the scalar KeccakF1600_StatePermute, with
+ * every 64-bit lane replaced by a 256-bit vector holding the corresponding
+ * lane of four independent states.
+ */
+
+#include <stdint.h>
+
+#include "../../../../sys.h"
+#include "KeccakP_1600_times4_SIMD256.h"
+
+#if defined(MLD_CONFIG_USE_NATIVE_BACKEND_FIPS202) && \
+    defined(MLD_SYS_X86_64_AVX2)
+
+#include <immintrin.h>
+
+#define NROUNDS 24
+
+#define XOR256(a, b) _mm256_xor_si256(a, b)
+#define ANDnu256(a, b) _mm256_andnot_si256(a, b)
+#define ROL64in256(a, o) \
+  _mm256_or_si256(_mm256_slli_epi64(a, o), _mm256_srli_epi64(a, 64 - (o)))
+/* Rotations by multiples of 8 are byte shuffles */
+#define ROL64in256_8(a) _mm256_shuffle_epi8(a, rho8)
+#define ROL64in256_56(a) _mm256_shuffle_epi8(a, rho56)
+
+#define XOR5(a, b, c, d, e) XOR256(XOR256(XOR256(a, b), XOR256(c, d)), e)
+#define CHI(a, b, c) XOR256(a, ANDnu256(b, c))
+
+/* One round of Keccak-f[1600] on four states: theta, rho, pi, chi and iota.
+ * Reads the state from the A-variables and writes it to the E-variables. */
+#define KECCAK_X4_ROUND(A, E, rc)                           \
+  do                                                        \
+  {                                                         \
+    BCa = XOR5(A##ba, A##ga, A##ka, A##ma, A##sa);          \
+    BCe = XOR5(A##be, A##ge, A##ke, A##me, A##se);          \
+    BCi = XOR5(A##bi, A##gi, A##ki, A##mi, A##si);          \
+    BCo = XOR5(A##bo, A##go, A##ko, A##mo, A##so);          \
+    BCu = XOR5(A##bu, A##gu, A##ku, A##mu, A##su);          \
+                                                            \
+    Da = XOR256(BCu, ROL64in256(BCe, 1));                   \
+    De = XOR256(BCa, ROL64in256(BCi, 1));                   \
+    Di = XOR256(BCe, ROL64in256(BCo, 1));                   \
+    Do = XOR256(BCi, ROL64in256(BCu, 1));                   \
+    Du = XOR256(BCo, ROL64in256(BCa, 1));                   \
+                                                            \
+    BCa = XOR256(A##ba, Da);                                \
+    BCe = ROL64in256(XOR256(A##ge, De), 44);                \
+    BCi = ROL64in256(XOR256(A##ki, Di), 43);                \
+    BCo = ROL64in256(XOR256(A##mo, Do), 21);                \
+    BCu = ROL64in256(XOR256(A##su, Du), 14);                \
+    E##ba = XOR256(CHI(BCa, BCe, BCi), rc);                 \
+    E##be = CHI(BCe, BCi, BCo);                             \
+    E##bi = CHI(BCi, BCo, BCu);                             \
+    E##bo = CHI(BCo, BCu, BCa);                             \
+    E##bu = CHI(BCu, BCa, BCe);                             \
+                                                            \
+    BCa = ROL64in256(XOR256(A##bo, Do), 28);                \
+    BCe = ROL64in256(XOR256(A##gu, Du), 20);                \
+    BCi = ROL64in256(XOR256(A##ka, Da), 3);                 \
+    BCo = ROL64in256(XOR256(A##me, De), 45);                \
+    BCu = ROL64in256(XOR256(A##si, Di), 61);                \
+    E##ga = CHI(BCa, BCe, BCi);                             \
+    E##ge = CHI(BCe, BCi, BCo);                             \
+    E##gi = CHI(BCi, BCo, BCu);                             \
+    E##go = CHI(BCo, BCu, BCa);                             \
+    E##gu = CHI(BCu, BCa, BCe);                             \
+                                                            \
+    BCa = ROL64in256(XOR256(A##be, De), 1);                 \
+    BCe = ROL64in256(XOR256(A##gi, Di), 6);                 \
+    BCi = ROL64in256(XOR256(A##ko, Do), 25);                \
+    BCo = ROL64in256_8(XOR256(A##mu, Du));                  \
+    BCu = ROL64in256(XOR256(A##sa, Da), 18);                \
+    E##ka = CHI(BCa, BCe, BCi);                             \
+    E##ke = CHI(BCe, BCi, BCo);                             \
+    E##ki = CHI(BCi, BCo, BCu);                             \
+    E##ko = CHI(BCo, BCu, BCa);                             \
+    E##ku = CHI(BCu, BCa, BCe);                             \
+                                                            \
+    BCa = ROL64in256(XOR256(A##bu, Du), 27);                \
+    BCe = ROL64in256(XOR256(A##ga, Da), 36);                \
+    BCi = ROL64in256(XOR256(A##ke, De), 10);                \
+    BCo = ROL64in256(XOR256(A##mi, Di), 15);                \
+    BCu = ROL64in256_56(XOR256(A##so, Do));                 \
+    E##ma = CHI(BCa, BCe, BCi);                             \
+    E##me = CHI(BCe, BCi, BCo);                             \
+    E##mi = CHI(BCi, BCo, BCu);                             \
+    E##mo = CHI(BCo, BCu, BCa);                             \
+    E##mu = CHI(BCu, BCa, BCe);                             \
+                                                            \
+    BCa = ROL64in256(XOR256(A##bi, Di), 62);                \
+    BCe = ROL64in256(XOR256(A##go, Do), 55);                \
+    BCi = ROL64in256(XOR256(A##ku, Du), 39);                \
+    BCo = ROL64in256(XOR256(A##ma, Da), 41);                \
+    BCu = ROL64in256(XOR256(A##se, De), 2);                 \
+    E##sa = CHI(BCa, BCe, BCi);                             \
+    E##se = CHI(BCe, BCi, BCo);                             \
+    E##si = CHI(BCi, BCo, BCu);                             \
+    E##so = CHI(BCo, BCu, BCa);                             \
+    E##su = CHI(BCu, BCa, BCe);                             \
+  } while (0)
+
+#define LOAD(i) _mm256_loadu_si256((const __m256i *)(states + 4 * (i)))
+#define STORE(i, v) _mm256_storeu_si256((__m256i *)(states + 4 * (i)), v)
+
+MLD_TARGET_AVX2
+void KeccakP1600times4_PermuteAll_24rounds(uint64_t *states)
+{
+  int round;
+  const __m256i rho8 = _mm256_setr_epi8(
+      7, 0, 1, 2, 3, 4, 5, 6, 15, 8, 9, 10, 11, 12, 13, 14, 7, 0, 1, 2, 3, 4,
+      5, 6, 15, 8, 9, 10, 11, 12, 13, 14);
+  const __m256i rho56 = _mm256_setr_epi8(
+      1, 2, 3, 4, 5, 6, 7, 0, 9, 10, 11, 12, 13, 14, 15, 8, 1, 2, 3, 4, 5, 6,
+      7, 0, 9, 10, 11, 12, 13, 14, 15, 8);
+
+  __m256i Aba, Abe, Abi, Abo, Abu;
+  __m256i Aga, Age, Agi, Ago, Agu;
+  __m256i Aka, Ake, Aki, Ako, Aku;
+  __m256i Ama, Ame, Ami, Amo, Amu;
+  __m256i Asa, Ase, Asi, Aso, Asu;
+  __m256i BCa, BCe, BCi, BCo, BCu;
+  __m256i Da, De, Di, Do, Du;
+  __m256i Eba, Ebe, Ebi, Ebo, Ebu;
+  __m256i Ega, Ege, Egi, Ego, Egu;
+  __m256i Eka, Eke, Eki, Eko, Eku;
+  __m256i Ema, Eme, Emi, Emo, Emu;
+  __m256i Esa, Ese, Esi, Eso, Esu;
+
+  Aba = LOAD(0);
+  Abe = LOAD(1);
+  Abi = LOAD(2);
+  Abo = LOAD(3);
+  Abu = LOAD(4);
+  Aga = LOAD(5);
+  Age = LOAD(6);
+  Agi = LOAD(7);
+  Ago = LOAD(8);
+  Agu = LOAD(9);
+  Aka = LOAD(10);
+  Ake = LOAD(11);
+  Aki = LOAD(12);
+  Ako = LOAD(13);
+  Aku = LOAD(14);
+  Ama = LOAD(15);
+  Ame = LOAD(16);
+  Ami = LOAD(17);
+  Amo = LOAD(18);
+  Amu = LOAD(19);
+  Asa = LOAD(20);
+  Ase = LOAD(21);
+  Asi = LOAD(22);
+  Aso = LOAD(23);
+  Asu = LOAD(24);
+
+  for (round = 0; round < NROUNDS; round += 2)
+  {
+    KECCAK_X4_ROUND(A, E,
+                    _mm256_set1_epi64x(
+                        (long long)KeccakF_RoundConstants[round]));
+    KECCAK_X4_ROUND(E, A,
+                    _mm256_set1_epi64x(
+                        (long long)KeccakF_RoundConstants[round + 1]));
+  }
+
+  STORE(0, Aba);
+  STORE(1, Abe);
+  STORE(2, Abi);
+  STORE(3, Abo);
+  STORE(4, Abu);
+  STORE(5, Aga);
+  STORE(6, Age);
+  STORE(7, Agi);
+  STORE(8, Ago);
+  STORE(9, Agu);
+  STORE(10, Aka);
+  STORE(11, Ake);
+  STORE(12, Aki);
+  STORE(13, Ako);
+  STORE(14, Aku);
+  STORE(15, Ama);
+  STORE(16, Ame);
+  STORE(17, Ami);
+  STORE(18, Amo);
+  STORE(19, Amu);
+  STORE(20, Asa);
+  STORE(21, Ase);
+  STORE(22, Asi);
+  STORE(23, Aso);
+  STORE(24, Asu);
+}
+
+#else /* MLD_CONFIG_USE_NATIVE_BACKEND_FIPS202 && MLD_SYS_X86_64_AVX2 */
+
+/* Avoid an empty translation unit */
+extern int FIPS202_NAMESPACE(empty_cu_keccakp_1600_times4_simd256);
+
+#endif /* !(MLD_CONFIG_USE_NATIVE_BACKEND_FIPS202 && MLD_SYS_X86_64_AVX2) */
@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MLD_FIPS202_NATIVE_X86_64_XKCP_H
+#define MLD_FIPS202_NATIVE_X86_64_XKCP_H
+
+#include <stdint.h>
+
+#define MLD_FIPS202_X86_64_XKCP
+
+#if !defined(__ASSEMBLER__)
+#include "src/KeccakP_1600_times4_SIMD256.h"
+
+#define MLD_USE_FIPS202_X4_NATIVE
+static MLD_INLINE int keccakf1600x4_permute_native(uint64_t *state)
+{
+  if (!mld_sys_check_capability(MLD_SYS_CAP_AVX2))
+  {
+    return MLD_NATIVE_FUNC_FALLBACK;
+  }
+  KeccakP1600times4_PermuteAll_24rounds(state);
+  return MLD_NATIVE_FUNC_SUCCESS;
+}
+#endif /* !__ASSEMBLER__ */
+
+#endif /* !MLD_FIPS202_NATIVE_X86_64_XKCP_H */
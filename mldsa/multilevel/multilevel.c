@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Unified interface over the ML-DSA-44, ML-DSA-65 and ML-DSA-87 builds
+ * linked into the combined library. Every call looks up the parameter set
+ * recorded in its key or signature handle and forwards to the namespaced
+ * implementation of that parameter set.
+ *
+ * This file is compiled once, independently of MLDSA_MODE.
+ */
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../api.h"
+
+typedef struct
+{
+  int level;
+  size_t pkbytes;
+  size_t skbytes;
+  size_t sigbytes;
+  int (*keypair)(uint8_t *pk, uint8_t *sk);
+  int (*signature)(uint8_t *sig, size_t *siglen, const uint8_t *m,
+                   size_t mlen, const uint8_t *ctx, size_t ctxlen,
+                   const uint8_t *sk);
+  int (*verify)(const uint8_t *sig, size_t siglen, const uint8_t *m,
+                size_t mlen, const uint8_t *ctx, size_t ctxlen,
+                const uint8_t *pk);
+} mld_level_ops;
+
+static const mld_level_ops mld_levels[] = {
+    {MLD_LEVEL_44, MLD_44_PUBLICKEYBYTES, MLD_44_SECRETKEYBYTES, MLD_44_BYTES,
+     MLD_44_ref_keypair, MLD_44_ref_signature, MLD_44_ref_verify},
+    {MLD_LEVEL_65, MLD_65_PUBLICKEYBYTES, MLD_65_SECRETKEYBYTES, MLD_65_BYTES,
+     MLD_65_ref_keypair, MLD_65_ref_signature, MLD_65_ref_verify},
+    {MLD_LEVEL_87, MLD_87_PUBLICKEYBYTES, MLD_87_SECRETKEYBYTES, MLD_87_BYTES,
+     MLD_87_ref_keypair, MLD_87_ref_signature, MLD_87_ref_verify},
+};
+
+static const mld_level_ops *mld_level_lookup(int level)
+{
+  size_t i;
+  for (i = 0; i < sizeof(mld_levels) / sizeof(mld_levels[0]); i++)
+  {
+    if (mld_levels[i].level == level)
+    {
+      return &mld_levels[i];
+    }
+  }
+  return NULL;
+}
+
+size_t MLD_ref_publickeybytes(int level)
+{
+  const mld_level_ops *ops = mld_level_lookup(level);
+  return ops == NULL ? 0 : ops->pkbytes;
+}
+
+size_t MLD_ref_secretkeybytes(int level)
+{
+  const mld_level_ops *ops = mld_level_lookup(level);
+  return ops == NULL ? 0 : ops->skbytes;
+}
+
+size_t MLD_ref_signaturebytes(int level)
+{
+  const mld_level_ops *ops = mld_level_lookup(level);
+  return ops == NULL ? 0 : ops->sigbytes;
+}
+
+int MLD_ref_keypair(int level, struct MLD_ref_public_key *pk,
+                    struct MLD_ref_secret_key *sk)
+{
+  const mld_level_ops *ops = mld_level_lookup(level);
+  if (ops == NULL)
+  {
+    return -1;
+  }
+
+  pk->level = level;
+  sk->level = level;
+  return ops->keypair(pk->bytes, sk->bytes);
+}
+
+int MLD_ref_import_pk(struct MLD_ref_public_key *pk, int level,
+                      const uint8_t *buf, size_t buflen)
+{
+  const mld_level_ops *ops = mld_level_lookup(level);
+  if (ops == NULL || buflen != ops->pkbytes)
+  {
+    return -1;
+  }
+
+  pk->level = level;
+  memcpy(pk->bytes, buf, buflen);
+  return 0;
+}
+
+int MLD_ref_import_sk(struct MLD_ref_secret_key *sk, int level,
+                      const uint8_t *buf, size_t buflen)
+{
+  const mld_level_ops *ops = mld_level_lookup(level);
+  if (ops == NULL || buflen != ops->skbytes)
+  {
+    return -1;
+  }
+
+  sk->level = level;
+  memcpy(sk->bytes, buf, buflen);
+  return 0;
+}
+
+int MLD_ref_import_sig(struct MLD_ref_signature *sig, int level,
+                       const uint8_t *buf, size_t buflen)
+{
+  const mld_level_ops *ops = mld_level_lookup(level);
+  if (ops == NULL || buflen != ops->sigbytes)
+  {
+    return -1;
+  }
+
+  sig->level = level;
+  sig->len = buflen;
+  memcpy(sig->bytes, buf, buflen);
+  return 0;
+}
+
+int MLD_ref_sign(struct MLD_ref_signature *sig, const uint8_t *m, size_t mlen,
+                 const uint8_t *ctx, size_t ctxlen,
+                 const struct MLD_ref_secret_key *sk)
+{
+  const mld_level_ops *ops = mld_level_lookup(sk->level);
+  if (ops == NULL)
+  {
+    return -1;
+  }
+
+  sig->level = sk->level;
+  return ops->signature(sig->bytes, &sig->len, m, mlen, ctx, ctxlen,
+                        sk->bytes);
+}
+
+int MLD_ref_verify(const struct MLD_ref_signature *sig, const uint8_t *m,
+                   size_t mlen, const uint8_t *ctx, size_t ctxlen,
+                   const struct MLD_ref_public_key *pk)
+{
+  const mld_level_ops *ops = mld_level_lookup(pk->level);
+  if (ops == NULL || sig->level != pk->level)
+  {
+    return -1;
+  }
+
+  return ops->verify(sig->bytes, sig->len, m, mlen, ctx, ctxlen, pk->bytes);
+}
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MLD_NATIVE_API_H
+#define MLD_NATIVE_API_H
+/*
+ * Arithmetic native interface
+ *
+ * This header is primarily for documentation purposes.
+ * It should not be included by backend implementations.
+ *
+ * An arithmetic backend is selected via MLD_CONFIG_USE_NATIVE_BACKEND_ARITH
+ * and signals which functions it provides by defining the corresponding
+ * MLD_USE_NATIVE_XXX macro. Functions which are not provided by the
+ * backend fall back to the portable C implementation.
+ */
+
+#include <stdint.h>
+
+/*
+ * Those functions are meant to be trivial wrappers around
+ * the chosen native implementation. The are static inline
+ * to avoid unnecessary calls.
+ * The macro before each declaration controls whether a native
+ * implementation is present.
+ *
+ * Unless stated otherwise, each function returns MLD_NATIVE_FUNC_SUCCESS
+ * once it has computed its result, or MLD_NATIVE_FUNC_FALLBACK without
+ * touching its output if it cannot be used, e.g. because the CPU lacks the
+ * required instructions. In the latter case, the caller falls back to the
+ * C implementation.
+ */
+
+#if defined(MLD_USE_NATIVE_NTT)
+/*************************************************
+ * Name:        ntt_native
+ *
+ * Description: Computes the number-theoretic transform (NTT) of a
+ *              polynomial in place.
+ *
+ *              The input and output order and bounds are as for the C
+ *              implementation of ntt(); the output must be identical.
+ *
+ * Arguments:   - int32_t data[MLDSA_N]: pointer to in/output polynomial
+ **************************************************/
+static MLD_INLINE int ntt_native(int32_t data[MLDSA_N]);
+#endif /* MLD_USE_NATIVE_NTT */
+
+#if defined(MLD_USE_NATIVE_INTT)
+/*************************************************
+ * Name:        intt_native
+ *
+ * Description: Computes the inverse NTT of a polynomial in place,
+ *              followed by multiplication with the Montgomery factor 2^32.
+ *
+ *              The input and output order and bounds are as for the C
+ *              implementation of invntt_tomont(); the output must be
+ *              identical.
+ *
+ * Arguments:   - int32_t data[MLDSA_N]: pointer to in/output polynomial
+ **************************************************/
+static MLD_INLINE int intt_native(int32_t data[MLDSA_N]);
+#endif /* MLD_USE_NATIVE_INTT */
+
+#if defined(MLD_USE_NATIVE_REJ_UNIFORM)
+/*************************************************
+ * Name:        rej_uniform_native
+ *
+ * Description: Run rejection sampling on uniform random bytes to generate
+ *              uniform random integers in [0, MLDSA_Q - 1].
+ *
+ * Arguments:   - int32_t *r: pointer to output buffer
+ *              - unsigned int len: requested number of coefficients
+ *              - const uint8_t *buf: pointer to input buffer
+ *              - unsigned int buflen: length of input buffer in bytes,
+ *                a multiple of 3
+ *
+ * Return MLD_NATIVE_FUNC_FALLBACK if the native implementation does not
+ * support the input lengths or the CPU.
+ * Otherwise, returns non-negative number of sampled coefficients, which must
+ * be equal to what the C implementation of rej_uniform would return.
+ **************************************************/
+static MLD_INLINE int rej_uniform_native(int32_t *r, unsigned int len,
+                                         const uint8_t *buf,
+                                         unsigned int buflen);
+#endif /* MLD_USE_NATIVE_REJ_UNIFORM */
+
+#if defined(MLD_USE_NATIVE_POLYETA_PACK)
+/*************************************************
+ * Name:        polyeta_pack_native
+ *
+ * Description: Bit-pack polynomial with coefficients in [-MLDSA_ETA,MLDSA_ETA].
+ *
+ *              The input bounds and the output format are as for the C
+ *              implementation of polyeta_pack(); the output must be identical.
+ *
+ * Arguments:   - uint8_t *r: pointer to output byte array
+ *              - const int32_t a[MLDSA_N]: pointer to input polynomial
+ **************************************************/
+static MLD_INLINE int polyeta_pack_native(uint8_t *r, const int32_t a[MLDSA_N]);
+#endif /* MLD_USE_NATIVE_POLYETA_PACK */
+
+#if defined(MLD_USE_NATIVE_POLYETA_UNPACK)
+/*************************************************
+ * Name:        polyeta_unpack_native
+ *
+ * Description: Unpack polynomial with coefficients in [-MLDSA_ETA,MLDSA_ETA].
+ *
+ *              The output must be identical to that of the C
+ *              implementation of polyeta_unpack() for any input.
+ *
+ * Arguments:   - int32_t r[MLDSA_N]: pointer to output polynomial
+ *              - const uint8_t *a: pointer to input byte array
+ **************************************************/
+static MLD_INLINE int polyeta_unpack_native(int32_t r[MLDSA_N],
+                                            const uint8_t *a);
+#endif /* MLD_USE_NATIVE_POLYETA_UNPACK */
+
+#if defined(MLD_USE_NATIVE_POLYT1_PACK)
+/*************************************************
+ * Name:        polyt1_pack_native
+ *
+ * Description: Bit-pack polynomial t1 with coefficients fitting in 10 bits.
+ *
+ *              The input bounds and the output format are as for the C
+ *              implementation of polyt1_pack(); the output must be identical.
+ *
+ * Arguments:   - uint8_t *r: pointer to output byte array
+ *              - const int32_t a[MLDSA_N]: pointer to input polynomial
+ **************************************************/
+static MLD_INLINE int polyt1_pack_native(uint8_t *r, const int32_t a[MLDSA_N]);
+#endif /* MLD_USE_NATIVE_POLYT1_PACK */
+
+#if defined(MLD_USE_NATIVE_POLYT1_UNPACK)
+/*************************************************
+ * Name:        polyt1_unpack_native
+ *
+ * Description: Unpack polynomial t1.
+ *
+ *              The output must be identical to that of the C
+ *              implementation of polyt1_unpack() for any input.
+ *
+ * Arguments:   - int32_t r[MLDSA_N]: pointer to output polynomial
+ *              - const uint8_t *a: pointer to input byte array
+ **************************************************/
+static MLD_INLINE int polyt1_unpack_native(int32_t r[MLDSA_N],
+                                           const uint8_t *a);
+#endif /* MLD_USE_NATIVE_POLYT1_UNPACK */
+
+#if defined(MLD_USE_NATIVE_POLYT0_PACK)
+/*************************************************
+ * Name:        polyt0_pack_native
+ *
+ * Description: Bit-pack polynomial t0 with coefficients in
+ *              (-2^{MLDSA_D-1}, 2^{MLDSA_D-1}].
+ *
+ *              The input bounds and the output format are as for the C
+ *              implementation of polyt0_pack(); the output must be identical.
+ *
+ * Arguments:   - uint8_t *r: pointer to output byte array
+ *              - const int32_t a[MLDSA_N]: pointer to input polynomial
+ **************************************************/
+static MLD_INLINE int polyt0_pack_native(uint8_t *r, const int32_t a[MLDSA_N]);
+#endif /* MLD_USE_NATIVE_POLYT0_PACK */
+
+#if defined(MLD_USE_NATIVE_POLYT0_UNPACK)
+/*************************************************
+ * Name:        polyt0_unpack_native
+ *
+ * Description: Unpack polynomial t0.
+ *
+ *              The output must be identical to that of the C
+ *              implementation of polyt0_unpack() for any input.
+ *
+ * Arguments:   - int32_t r[MLDSA_N]: pointer to output polynomial
+ *              - const uint8_t *a: pointer to input byte array
+ **************************************************/
+static MLD_INLINE int polyt0_unpack_native(int32_t r[MLDSA_N],
+                                           const uint8_t *a);
+#endif /* MLD_USE_NATIVE_POLYT0_UNPACK */
+
+#if defined(MLD_USE_NATIVE_POLYZ_PACK)
+/*************************************************
+ * Name:        polyz_pack_native
+ *
+ * Description: Bit-pack polynomial z with coefficients in
+ *              [-(MLDSA_GAMMA1 - 1), MLDSA_GAMMA1].
+ *
+ *              The input bounds and the output format are as for the C
+ *              implementation of polyz_pack(); the output must be identical.
+ *
+ * Arguments:   - uint8_t *r: pointer to output byte array
+ *              - const int32_t a[MLDSA_N]: pointer to input polynomial
+ **************************************************/
+static MLD_INLINE int polyz_pack_native(uint8_t *r, const int32_t a[MLDSA_N]);
+#endif /* MLD_USE_NATIVE_POLYZ_PACK */
+
+#if defined(MLD_USE_NATIVE_POLYZ_UNPACK)
+/*************************************************
+ * Name:        polyz_unpack_native
+ *
+ * Description: Unpack polynomial z.
+ *
+ *              The output must be identical to that of the C
+ *              implementation of polyz_unpack() for any input.
+ *
+ * Arguments:   - int32_t r[MLDSA_N]: pointer to output polynomial
+ *              - const uint8_t *a: pointer to input byte array
+ **************************************************/
+static MLD_INLINE int polyz_unpack_native(int32_t r[MLDSA_N],
+                                          const uint8_t *a);
+#endif /* MLD_USE_NATIVE_POLYZ_UNPACK */
+
+#if defined(MLD_USE_NATIVE_POLYW1_PACK)
+/*************************************************
+ * Name:        polyw1_pack_native
+ *
+ * Description: Bit-pack polynomial w1 with coefficients in [0, 15] or
+ *              [0, 43], depending on MLDSA_GAMMA2.
+ *
+ *              The input bounds and the output format are as for the C
+ *              implementation of polyw1_pack(); the output must be identical.
+ *
+ * Arguments:   - uint8_t *r: pointer to output byte array
+ *              - const int32_t a[MLDSA_N]: pointer to input polynomial
+ **************************************************/
+static MLD_INLINE int polyw1_pack_native(uint8_t *r, const int32_t a[MLDSA_N]);
+#endif /* MLD_USE_NATIVE_POLYW1_PACK */
+
+#endif /* !MLD_NATIVE_API_H */
@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MLD_NATIVE_AUTO_H
+#define MLD_NATIVE_AUTO_H
+
+/*
+ * Default arithmetic backend
+ *
+ * Selects a native arithmetic backend based on the capabilities of the
+ * target as detected in sys.h.
+ */
+
+#include "../sys.h"
+
+#if defined(MLD_SYS_X86_64_AVX2)
+#include "x86_64/meta.h"
+#endif
+
+#endif /* !MLD_NATIVE_AUTO_H */
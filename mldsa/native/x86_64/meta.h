@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MLD_NATIVE_X86_64_META_H
+#define MLD_NATIVE_X86_64_META_H
+
+/* Identifier for this backend so that source and assembly files
+ * in the build can be appropriately guarded. */
+#define MLD_ARITH_BACKEND_X86_64_DEFAULT
+
+#define MLD_USE_NATIVE_NTT
+#define MLD_USE_NATIVE_INTT
+#define MLD_USE_NATIVE_REJ_UNIFORM
+#define MLD_USE_NATIVE_POLYETA_PACK
+#define MLD_USE_NATIVE_POLYETA_UNPACK
+#define MLD_USE_NATIVE_POLYT1_PACK
+#define MLD_USE_NATIVE_POLYT1_UNPACK
+#define MLD_USE_NATIVE_POLYT0_PACK
+#define MLD_USE_NATIVE_POLYT0_UNPACK
+#define MLD_USE_NATIVE_POLYZ_PACK
+#define MLD_USE_NATIVE_POLYZ_UNPACK
+#define MLD_USE_NATIVE_POLYW1_PACK
+
+#if !defined(__ASSEMBLER__)
+#include "src/arith_native_x86_64.h"
+
+static MLD_INLINE int ntt_native(int32_t data[MLDSA_N])
+{
+  if (!mld_sys_check_capability(MLD_SYS_CAP_AVX2))
+  {
+    return MLD_NATIVE_FUNC_FALLBACK;
+  }
+  mld_ntt_avx2(data);
+  return MLD_NATIVE_FUNC_SUCCESS;
+}
+
+static MLD_INLINE int intt_native(int32_t data[MLDSA_N])
+{
+  if (!mld_sys_check_capability(MLD_SYS_CAP_AVX2))
+  {
+    return MLD_NATIVE_FUNC_FALLBACK;
+  }
+  mld_invntt_avx2(data);
+  return MLD_NATIVE_FUNC_SUCCESS;
+}
+
+static MLD_INLINE int rej_uniform_native(int32_t *r, unsigned int len,
+                                         const uint8_t *buf,
+                                         unsigned int buflen)
+{
+  if (!mld_sys_check_capability(MLD_SYS_CAP_AVX2))
+  {
+    return MLD_NATIVE_FUNC_FALLBACK;
+  }
+  return (int)mld_rej_uniform_avx2(r, len, buf, buflen);
+}
+
+static MLD_INLINE int polyeta_pack_native(uint8_t *r, const int32_t a[MLDSA_N])
+{
+  if (!mld_sys_check_capability(MLD_SYS_CAP_AVX2))
+  {
+    return MLD_NATIVE_FUNC_FALLBACK;
+  }
+  mld_polyeta_pack_avx2(r, a);
+  return MLD_NATIVE_FUNC_SUCCESS;
+}
+
+static MLD_INLINE int polyeta_unpack_native(int32_t r[MLDSA_N],
+                                             const uint8_t *a)
+{
+  if (!mld_sys_check_capability(MLD_SYS_CAP_AVX2))
+  {
+    return MLD_NATIVE_FUNC_FALLBACK;
+  }
+  mld_polyeta_unpack_avx2(r, a);
+  return MLD_NATIVE_FUNC_SUCCESS;
+}
+
+static MLD_INLINE int polyt1_pack_native(uint8_t *r, const int32_t a[MLDSA_N])
+{
+  if (!mld_sys_check_capability(MLD_SYS_CAP_AVX2))
+  {
+    return MLD_NATIVE_FUNC_FALLBACK;
+  }
+  mld_polyt1_pack_avx2(r, a);
+  return MLD_NATIVE_FUNC_SUCCESS;
+}
+
+static MLD_INLINE int polyt1_unpack_native(int32_t r[MLDSA_N],
+                                            const uint8_t *a)
+{
+  if (!mld_sys_check_capability(MLD_SYS_CAP_AVX2))
+  {
+    return MLD_NATIVE_FUNC_FALLBACK;
+  }
+  mld_polyt1_unpack_avx2(r, a);
+  return MLD_NATIVE_FUNC_SUCCESS;
+}
+
+static MLD_INLINE int polyt0_pack_native(uint8_t *r, const int32_t a[MLDSA_N])
+{
+  if (!mld_sys_check_capability(MLD_SYS_CAP_AVX2))
+  {
+    return MLD_NATIVE_FUNC_FALLBACK;
+  }
+  mld_polyt0_pack_avx2(r, a);
+  return MLD_NATIVE_FUNC_SUCCESS;
+}
+
+static MLD_INLINE int polyt0_unpack_native(int32_t r[MLDSA_N],
+                                            const uint8_t *a)
+{
+  if (!mld_sys_check_capability(MLD_SYS_CAP_AVX2))
+  {
+    return MLD_NATIVE_FUNC_FALLBACK;
+  }
+  mld_polyt0_unpack_avx2(r, a);
+  return MLD_NATIVE_FUNC_SUCCESS;
+}
+
+static MLD_INLINE int polyz_pack_native(uint8_t *r, const int32_t a[MLDSA_N])
+{
+  if (!mld_sys_check_capability(MLD_SYS_CAP_AVX2))
+  {
+    return MLD_NATIVE_FUNC_FALLBACK;
+  }
+  mld_polyz_pack_avx2(r, a);
+  return MLD_NATIVE_FUNC_SUCCESS;
+}
+
+static MLD_INLINE int polyz_unpack_native(int32_t r[MLDSA_N],
+                                           const uint8_t *a)
+{
+  if (!mld_sys_check_capability(MLD_SYS_CAP_AVX2))
+  {
+    return MLD_NATIVE_FUNC_FALLBACK;
+  }
+  mld_polyz_unpack_avx2(r, a);
+  return MLD_NATIVE_FUNC_SUCCESS;
+}
+
+static MLD_INLINE int polyw1_pack_native(uint8_t *r, const int32_t a[MLDSA_N])
+{
+  if (!mld_sys_check_capability(MLD_SYS_CAP_AVX2))
+  {
+    return MLD_NATIVE_FUNC_FALLBACK;
+  }
+  mld_polyw1_pack_avx2(r, a);
+  return MLD_NATIVE_FUNC_SUCCESS;
+}
+#endif /* !__ASSEMBLER__ */
+
+#endif /* !MLD_NATIVE_X86_64_META_H */
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MLD_NATIVE_X86_64_SRC_ARITH_NATIVE_X86_64_H
+#define MLD_NATIVE_X86_64_SRC_ARITH_NATIVE_X86_64_H
+
+#include <stdint.h>
+#include "../../../common.h"
+
+#define mld_rej_uniform_table MLD_NAMESPACE(rej_uniform_table)
+extern const uint8_t mld_rej_uniform_table[256][8];
+
+#define mld_rej_uniform_avx2 MLD_NAMESPACE(rej_uniform_avx2)
+unsigned int mld_rej_uniform_avx2(int32_t *r, unsigned int len,
+                                  const uint8_t *buf, unsigned int buflen);
+
+#define mld_ntt_avx2 MLD_NAMESPACE(ntt_avx2)
+void mld_ntt_avx2(int32_t *r);
+
+#define mld_invntt_avx2 MLD_NAMESPACE(invntt_avx2)
+void mld_invntt_avx2(int32_t *r);
+
+#define mld_polyeta_pack_avx2 MLD_NAMESPACE(polyeta_pack_avx2)
+void mld_polyeta_pack_avx2(uint8_t *r, const int32_t *a);
+
+#define mld_polyeta_unpack_avx2 MLD_NAMESPACE(polyeta_unpack_avx2)
+void mld_polyeta_unpack_avx2(int32_t *r, const uint8_t *a);
+
+#define mld_polyt1_pack_avx2 MLD_NAMESPACE(polyt1_pack_avx2)
+void mld_polyt1_pack_avx2(uint8_t *r, const int32_t *a);
+
+#define mld_polyt1_unpack_avx2 MLD_NAMESPACE(polyt1_unpack_avx2)
+void mld_polyt1_unpack_avx2(int32_t *r, const uint8_t *a);
+
+#define mld_polyt0_pack_avx2 MLD_NAMESPACE(polyt0_pack_avx2)
+void mld_polyt0_pack_avx2(uint8_t *r, const int32_t *a);
+
+#define mld_polyt0_unpack_avx2 MLD_NAMESPACE(polyt0_unpack_avx2)
+void mld_polyt0_unpack_avx2(int32_t *r, const uint8_t *a);
+
+#define mld_polyz_pack_avx2 MLD_NAMESPACE(polyz_pack_avx2)
+void mld_polyz_pack_avx2(uint8_t *r, const int32_t *a);
+
+#define mld_polyz_unpack_avx2 MLD_NAMESPACE(polyz_unpack_avx2)
+void mld_polyz_unpack_avx2(int32_t *r, const uint8_t *a);
+
+#define mld_polyw1_pack_avx2 MLD_NAMESPACE(polyw1_pack_avx2)
+void mld_polyw1_pack_avx2(uint8_t *r, const int32_t *a);
+
+#endif /* !MLD_NATIVE_X86_64_SRC_ARITH_NATIVE_X86_64_H */
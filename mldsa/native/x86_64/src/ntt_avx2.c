@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * AVX2 implementation of the forward and inverse NTT.
+ *
+ * Both transforms compute exactly the same butterflies as the C reference in
+ * mldsa/ntt.c, in the same (bit-reversed) coefficient order, and produce
+ * bit-identical results. They differ only in how butterflies are scheduled:
+ *
+ * - Layers 1-3 are merged and applied to groups of eight vectors of eight
+ *   coefficients each, taken at a stride of 32 coefficients.
+ * - Layers 4-8 are merged and applied to blocks of 32 contiguous
+ *   coefficients (four vectors). For the last three layers, where the
+ *   butterfly distance is smaller than a vector, pairs of vectors are
+ *   transposed so that butterflies again act on two full vectors; twiddle
+ *   factors for those layers are stored per lane, see ntt_avx2_zetas.inc.
+ *
+ * Montgomery multiplication uses vpmuldq, which multiplies the even 32-bit
+ * lanes of two vectors into 64-bit products; the odd lanes are handled by
+ * a second vpmuldq on the inputs shifted right by 32 bits.
+ */
+
+#include "../../../common.h"
+
+#if defined(MLD_ARITH_BACKEND_X86_64_DEFAULT)
+
+#include <immintrin.h>
+#include <stdint.h>
+#include "arith_native_x86_64.h"
+
+#include "ntt_avx2_zetas.inc"
+
+/* mont^2/256, as in invntt_tomont(), and its product with q^{-1} */
+/* check-magic: 41978 == signed_mod(2^64 * pow(256, -1, MLDSA_Q), MLDSA_Q) */
+#define MLD_AVX2_INTT_F 41978
+/* check-magic: -8395782 == signed_mod(41978 * pow(MLDSA_Q, -1, 2^32), 2^32) */
+#define MLD_AVX2_INTT_F_QINV -8395782
+
+/*
+ * Montgomery multiplication of each lane of a with the corresponding lane
+ * of zeta; zeta_qinv must hold zeta * q^{-1} mod 2^32. Computes the same
+ * result as montgomery_reduce((int64_t)a * zeta) for each lane.
+ */
+MLD_TARGET_AVX2
+static MLD_INLINE __m256i mld_fqmul_avx2(__m256i a, __m256i zeta,
+                                         __m256i zeta_qinv)
+{
+  const __m256i q = _mm256_set1_epi32(MLDSA_Q);
+  __m256i a_odd, prod_even, prod_odd, t_even, t_odd;
+
+  a_odd = _mm256_srli_epi64(a, 32);
+
+  prod_even = _mm256_mul_epi32(a, zeta);
+  prod_odd = _mm256_mul_epi32(a_odd, _mm256_srli_epi64(zeta, 32));
+  /* The low 32 bits of t are a * zeta * q^{-1} mod 2^32, which is all
+   * vpmuldq below reads */
+  t_even = _mm256_mul_epi32(a, zeta_qinv);
+  t_odd = _mm256_mul_epi32(a_odd, _mm256_srli_epi64(zeta_qinv, 32));
+  t_even = _mm256_mul_epi32(t_even, q);
+  t_odd = _mm256_mul_epi32(t_odd, q);
+
+  /* The low 32 bits of the differences vanish by construction */
+  prod_even = _mm256_sub_epi64(prod_even, t_even);
+  prod_odd = _mm256_sub_epi64(prod_odd, t_odd);
+  prod_even = _mm256_srli_epi64(prod_even, 32);
+  return _mm256_blend_epi32(prod_even, prod_odd, 0xAA);
+}
+
+/* Cooley-Tukey butterfly, as in mld_ntt_butterfly_block() */
+MLD_TARGET_AVX2
+static MLD_INLINE void mld_ct_butterfly(__m256i *a, __m256i *b, __m256i zeta,
+                                        __m256i zeta_qinv)
+{
+  __m256i t;
+  t = mld_fqmul_avx2(*b, zeta, zeta_qinv);
+  *b = _mm256_sub_epi32(*a, t);
+  *a = _mm256_add_epi32(*a, t);
+}
+
+/* Gentleman-Sande butterfly, as in invntt_tomont() */
+MLD_TARGET_AVX2
+static MLD_INLINE void mld_gs_butterfly(__m256i *a, __m256i *b, __m256i zeta,
+                                        __m256i zeta_qinv)
+{
+  __m256i t;
+  t = *a;
+  *a = _mm256_add_epi32(t, *b);
+  *b = mld_fqmul_avx2(_mm256_sub_epi32(t, *b), zeta, zeta_qinv);
+}
+
+#define ZETA(k) _mm256_set1_epi32(mld_avx2_zetas[k])
+#define ZETA_QINV(k) _mm256_set1_epi32(mld_avx2_zetas_qinv[k])
+#define NEG_ZETA(k) _mm256_set1_epi32(-mld_avx2_zetas[k])
+#define NEG_ZETA_QINV(k) _mm256_set1_epi32(-mld_avx2_zetas_qinv[k])
+
+/*
+ * Transpositions between pairs of vectors x = (x0, ..., x7) and
+ * y = (y0, ..., y7), used for the layers with butterfly distance 4, 2 and 1.
+ *
+ * ab: a = (x0, x1, x2, x3, y0, y1, y2, y3), b = (x4, x5, x6, x7, y4, ...)
+ * cd: c = (x0, x1, x4, x5, y0, ...),        d = (x2, x3, x6, x7, y2, ...)
+ * ef: e = (x0, x4, x2, x6, y0, ...),        f = (x1, x5, x3, x7, y1, ...)
+ */
+MLD_TARGET_AVX2
+static MLD_INLINE void mld_xy_to_ab(__m256i *x, __m256i *y)
+{
+  const __m256i a = _mm256_permute2x128_si256(*x, *y, 0x20);
+  const __m256i b = _mm256_permute2x128_si256(*x, *y, 0x31);
+  *x = a;
+  *y = b;
+}
+
+#define mld_ab_to_xy mld_xy_to_ab
+
+MLD_TARGET_AVX2
+static MLD_INLINE void mld_ab_to_cd(__m256i *a, __m256i *b)
+{
+  const __m256i c = _mm256_unpacklo_epi64(*a, *b);
+  const __m256i d = _mm256_unpackhi_epi64(*a, *b);
+  *a = c;
+  *b = d;
+}
+
+#define mld_cd_to_ab mld_ab_to_cd
+
+MLD_TARGET_AVX2
+static MLD_INLINE void mld_cd_to_ef(__m256i *c, __m256i *d)
+{
+  const __m256 c_ps = _mm256_castsi256_ps(*c);
+  const __m256 d_ps = _mm256_castsi256_ps(*d);
+  *c = _mm256_castps_si256(_mm256_shuffle_ps(c_ps, d_ps, 0x88));
+  *d = _mm256_castps_si256(_mm256_shuffle_ps(c_ps, d_ps, 0xDD));
+}
+
+MLD_TARGET_AVX2
+static MLD_INLINE void mld_ef_to_cd(__m256i *e, __m256i *f)
+{
+  const __m256i c = _mm256_unpacklo_epi32(*e, *f);
+  const __m256i d = _mm256_unpackhi_epi32(*e, *f);
+  *e = c;
+  *f = d;
+}
+
+/* Apply a butterfly with per-lane twiddles taken from a table of
+ * eight zetas followed by the eight corresponding zeta * q^{-1} */
+#define CT_LANES(a, b, table)                                               \
+  mld_ct_butterfly(&(a), &(b), _mm256_load_si256((const __m256i *)(table)), \
+                   _mm256_load_si256((const __m256i *)((table) + 8)))
+#define GS_LANES(a, b, table)                                               \
+  mld_gs_butterfly(&(a), &(b), _mm256_load_si256((const __m256i *)(table)), \
+                   _mm256_load_si256((const __m256i *)((table) + 8)))
+
+MLD_TARGET_AVX2
+void mld_ntt_avx2(int32_t *r)
+{
+  unsigned int i, j, p;
+  __m256i v[8];
+  const int32_t *zetas_lanes = mld_avx2_zetas_ntt_layer678;
+
+  /* Layers 1-3 */
+  for (j = 0; j < 4; j++)
+  {
+    for (i = 0; i < 8; i++)
+    {
+      v[i] = _mm256_loadu_si256((const __m256i *)&r[8 * (j + 4 * i)]);
+    }
+
+    mld_ct_butterfly(&v[0], &v[4], ZETA(1), ZETA_QINV(1));
+    mld_ct_butterfly(&v[1], &v[5], ZETA(1), ZETA_QINV(1));
+    mld_ct_butterfly(&v[2], &v[6], ZETA(1), ZETA_QINV(1));
+    mld_ct_butterfly(&v[3], &v[7], ZETA(1), ZETA_QINV(1));
+
+    mld_ct_butterfly(&v[0], &v[2], ZETA(2), ZETA_QINV(2));
+    mld_ct_butterfly(&v[1], &v[3], ZETA(2), ZETA_QINV(2));
+    mld_ct_butterfly(&v[4], &v[6], ZETA(3), ZETA_QINV(3));
+    mld_ct_butterfly(&v[5], &v[7], ZETA(3), ZETA_QINV(3));
+
+    mld_ct_butterfly(&v[0], &v[1], ZETA(4), ZETA_QINV(4));
+    mld_ct_butterfly(&v[2], &v[3], ZETA(5), ZETA_QINV(5));
+    mld_ct_butterfly(&v[4], &v[5], ZETA(6), ZETA_QINV(6));
+    mld_ct_butterfly(&v[6], &v[7], ZETA(7), ZETA_QINV(7));
+
+    for (i = 0; i < 8; i++)
+    {
+      _mm256_storeu_si256((__m256i *)&r[8 * (j + 4 * i)], v[i]);
+    }
+  }
+
+  /* Layers 4-8 */
+  for (j = 0; j < 8; j++)
+  {
+    for (i = 0; i < 4; i++)
+    {
+      v[i] = _mm256_loadu_si256((const __m256i *)&r[32 * j + 8 * i]);
+    }
+
+    mld_ct_butterfly(&v[0], &v[2], ZETA(8 + j), ZETA_QINV(8 + j));
+    mld_ct_butterfly(&v[1], &v[3], ZETA(8 + j), ZETA_QINV(8 + j));
+
+    mld_ct_butterfly(&v[0], &v[1], ZETA(16 + 2 * j), ZETA_QINV(16 + 2 * j));
+    mld_ct_butterfly(&v[2], &v[3], ZETA(17 + 2 * j), ZETA_QINV(17 + 2 * j));
+
+    for (p = 0; p < 4; p += 2)
+    {
+      mld_xy_to_ab(&v[p], &v[p + 1]);
+      CT_LANES(v[p], v[p + 1], zetas_lanes);
+      mld_ab_to_cd(&v[p], &v[p + 1]);
+      CT_LANES(v[p], v[p + 1], zetas_lanes + 16);
+      mld_cd_to_ef(&v[p], &v[p + 1]);
+      CT_LANES(v[p], v[p + 1], zetas_lanes + 32);
+      mld_ef_to_cd(&v[p], &v[p + 1]);
+      mld_cd_to_ab(&v[p], &v[p + 1]);
+      mld_ab_to_xy(&v[p], &v[p + 1]);
+      zetas_lanes += 48;
+    }
+
+    for (i = 0; i < 4; i++)
+    {
+      _mm256_storeu_si256((__m256i *)&r[32 * j + 8 * i], v[i]);
+    }
+  }
+}
+
+MLD_TARGET_AVX2
+void mld_invntt_avx2(int32_t *r)
+{
+  unsigned int i, j, p;
+  __m256i v[8];
+  const int32_t *zetas_lanes = mld_avx2_zetas_intt_layer876;
+  const __m256i f = _mm256_set1_epi32(MLD_AVX2_INTT_F);
+  const __m256i f_qinv = _mm256_set1_epi32(MLD_AVX2_INTT_F_QINV);
+
+  /* Layers 8-4 */
+  for (j = 0; j < 8; j++)
+  {
+    for (i = 0; i < 4; i++)
+    {
+      v[i] = _mm256_loadu_si256((const __m256i *)&r[32 * j + 8 * i]);
+    }
+
+    for (p = 0; p < 4; p += 2)
+    {
+      mld_xy_to_ab(&v[p], &v[p + 1]);
+      mld_ab_to_cd(&v[p], &v[p + 1]);
+      mld_cd_to_ef(&v[p], &v[p + 1]);
+      GS_LANES(v[p], v[p + 1], zetas_lanes);
+      mld_ef_to_cd(&v[p], &v[p + 1]);
+      GS_LANES(v[p], v[p + 1], zetas_lanes + 16);
+      mld_cd_to_ab(&v[p], &v[p + 1]);
+      GS_LANES(v[p], v[p + 1], zetas_lanes + 32);
+      mld_ab_to_xy(&v[p], &v[p + 1]);
+      zetas_lanes += 48;
+    }
+
+    mld_gs_butterfly(&v[0], &v[1], NEG_ZETA(31 - 2 * j),
+                     NEG_ZETA_QINV(31 - 2 * j));
+    mld_gs_butterfly(&v[2], &v[3], NEG_ZETA(30 - 2 * j),
+                     NEG_ZETA_QINV(30 - 2 * j));
+
+    mld_gs_butterfly(&v[0], &v[2], NEG_ZETA(15 - j), NEG_ZETA_QINV(15 - j));
+    mld_gs_butterfly(&v[1], &v[3], NEG_ZETA(15 - j), NEG_ZETA_QINV(15 - j));
+
+    for (i = 0; i < 4; i++)
+    {
+      _mm256_storeu_si256((__m256i *)&r[32 * j + 8 * i], v[i]);
+    }
+  }
+
+  /* Layers 3-1, followed by the multiplication with mont^2/256 */
+  for (j = 0; j < 4; j++)
+  {
+    for (i = 0; i < 8; i++)
+    {
+      v[i] = _mm256_loadu_si256((const __m256i *)&r[8 * (j + 4 * i)]);
+    }
+
+    mld_gs_butterfly(&v[0], &v[1], NEG_ZETA(7), NEG_ZETA_QINV(7));
+    mld_gs_butterfly(&v[2], &v[3], NEG_ZETA(6), NEG_ZETA_QINV(6));
+    mld_gs_butterfly(&v[4], &v[5], NEG_ZETA(5), NEG_ZETA_QINV(5));
+    mld_gs_butterfly(&v[6], &v[7], NEG_ZETA(4), NEG_ZETA_QINV(4));
+
+    mld_gs_butterfly(&v[0], &v[2], NEG_ZETA(3), NEG_ZETA_QINV(3));
+    mld_gs_butterfly(&v[1], &v[3], NEG_ZETA(3), NEG_ZETA_QINV(3));
+    mld_gs_butterfly(&v[4], &v[6], NEG_ZETA(2), NEG_ZETA_QINV(2));
+    mld_gs_butterfly(&v[5], &v[7], NEG_ZETA(2), NEG_ZETA_QINV(2));
+
+    mld_gs_butterfly(&v[0], &v[4], NEG_ZETA(1), NEG_ZETA_QINV(1));
+    mld_gs_butterfly(&v[1], &v[5], NEG_ZETA(1), NEG_ZETA_QINV(1));
+    mld_gs_butterfly(&v[2], &v[6], NEG_ZETA(1), NEG_ZETA_QINV(1));
+    mld_gs_butterfly(&v[3], &v[7], NEG_ZETA(1), NEG_ZETA_QINV(1));
+
+    for (i = 0; i < 8; i++)
+    {
+      v[i] = mld_fqmul_avx2(v[i], f, f_qinv);
+      _mm256_storeu_si256((__m256i *)&r[8 * (j + 4 * i)], v[i]);
+    }
+  }
+}
+
+#else /* MLD_ARITH_BACKEND_X86_64_DEFAULT */
+
+/* Avoid an empty translation unit */
+extern int MLD_NAMESPACE(empty_cu_ntt_avx2);
+
+#endif /* !MLD_ARITH_BACKEND_X86_64_DEFAULT */
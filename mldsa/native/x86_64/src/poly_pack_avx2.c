@@ -0,0 +1,453 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * The w1 and 4-bit packing routines are based on the public domain AVX2
+ * implementation in the Dilithium reference repository
+ * https://github.com/pq-crystals/dilithium by Léo Ducas, Eike Kiltz,
+ * Tancrède Lepoint, Vadim Lyubashevsky, Gregor Seiler, Peter Schwabe and
+ * Damien Stehlé.
+ */
+
+#include "../../../common.h"
+
+#if defined(MLD_ARITH_BACKEND_X86_64_DEFAULT)
+
+#include <immintrin.h>
+#include <stdint.h>
+#include <string.h>
+#include "arith_native_x86_64.h"
+
+/*
+ * Coefficients of at least 8 bits (t1, t0, z) are handled in blocks of
+ * eight. Eight b-bit coefficients occupy b bytes, and the four
+ * coefficients in each 128-bit half of a vector are handled independently:
+ * the low half covers the bytes starting at 0, the high half the bytes
+ * starting at hb = floor(4b/8). A byte shuffle and a variable shift move
+ * each coefficient between its 32-bit lane and its position in the packed
+ * block.
+ *
+ * The kernels read and write up to 32 bytes from the start of a block.
+ * For the last blocks of a polynomial, they operate on a stack buffer
+ * instead so as not to access memory beyond the packed polynomial.
+ */
+#define MLD_PACK_BLOCK_BYTES 32
+
+MLD_TARGET_AVX2
+static MLD_INLINE const uint8_t *mld_unpack_src(
+    uint8_t buf[MLD_PACK_BLOCK_BYTES], const uint8_t *a, unsigned int off,
+    unsigned int blen, unsigned int total)
+{
+  if (off + MLD_PACK_BLOCK_BYTES <= total)
+  {
+    return a + off;
+  }
+  memset(buf, 0, MLD_PACK_BLOCK_BYTES);
+  memcpy(buf, a + off, blen);
+  return buf;
+}
+
+MLD_TARGET_AVX2
+static MLD_INLINE uint8_t *mld_pack_dst(uint8_t buf[MLD_PACK_BLOCK_BYTES],
+                                        uint8_t *r, unsigned int off,
+                                        unsigned int total)
+{
+  if (off + MLD_PACK_BLOCK_BYTES <= total)
+  {
+    return r + off;
+  }
+  return buf;
+}
+
+MLD_TARGET_AVX2
+static MLD_INLINE void mld_pack_flush(const uint8_t *dst,
+                                      const uint8_t buf[MLD_PACK_BLOCK_BYTES],
+                                      uint8_t *r, unsigned int off,
+                                      unsigned int blen)
+{
+  if (dst == buf)
+  {
+    memcpy(r + off, buf, blen);
+  }
+}
+
+/* Extracts eight b-bit coefficients from the block at a */
+MLD_TARGET_AVX2
+static MLD_INLINE __m256i mld_unpack8(const uint8_t *a, unsigned int hb,
+                                      const __m256i shufbidx,
+                                      const __m256i srlvdidx,
+                                      const __m256i mask)
+{
+  __m256i f;
+
+  f = _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)a));
+  f = _mm256_inserti128_si256(f, _mm_loadu_si128((const __m128i *)(a + hb)),
+                              1);
+  f = _mm256_shuffle_epi8(f, shufbidx);
+  f = _mm256_srlv_epi32(f, srlvdidx);
+  return _mm256_and_si256(f, mask);
+}
+
+/*
+ * Moves eight b-bit coefficients to their byte positions within each half.
+ * Coefficients of even and odd index are shuffled separately since
+ * neighbouring coefficients may share a byte.
+ */
+MLD_TARGET_AVX2
+static MLD_INLINE __m256i mld_pack8(__m256i f, const __m256i sllvdidx,
+                                    const __m256i shufbidx0,
+                                    const __m256i shufbidx1)
+{
+  f = _mm256_sllv_epi32(f, sllvdidx);
+  return _mm256_or_si256(_mm256_shuffle_epi8(f, shufbidx0),
+                         _mm256_shuffle_epi8(f, shufbidx1));
+}
+
+#if MLDSA_ETA == 4 || MLDSA_MODE != 2
+/* Packs 64 coefficients in [0, 15] from f[0], ..., f[7] to 32 bytes */
+MLD_TARGET_AVX2
+static MLD_INLINE void mld_pack4x64(uint8_t *r, __m256i f[8])
+{
+  const __m256i shift = _mm256_set1_epi16((16 << 8) + 1);
+  const __m256i shufbidx =
+      _mm256_set_epi8(15, 14, 7, 6, 13, 12, 5, 4, 11, 10, 3, 2, 9, 8, 1, 0, 15,
+                      14, 7, 6, 13, 12, 5, 4, 11, 10, 3, 2, 9, 8, 1, 0);
+  __m256i g0, g1, g2, g3;
+
+  g0 = _mm256_packus_epi32(f[0], f[1]);
+  g1 = _mm256_packus_epi32(f[2], f[3]);
+  g2 = _mm256_packus_epi32(f[4], f[5]);
+  g3 = _mm256_packus_epi32(f[6], f[7]);
+  g0 = _mm256_packus_epi16(g0, g1);
+  g1 = _mm256_packus_epi16(g2, g3);
+  g0 = _mm256_maddubs_epi16(g0, shift);
+  g1 = _mm256_maddubs_epi16(g1, shift);
+  g0 = _mm256_packus_epi16(g0, g1);
+  g0 = _mm256_permute4x64_epi64(g0, 0xD8);
+  g0 = _mm256_shuffle_epi8(g0, shufbidx);
+  _mm256_storeu_si256((__m256i *)r, g0);
+}
+#endif /* MLDSA_ETA == 4 || MLDSA_MODE != 2 */
+
+MLD_TARGET_AVX2
+void mld_polyeta_pack_avx2(uint8_t *r, const int32_t *a)
+{
+  unsigned int i;
+  const __m256i eta = _mm256_set1_epi32(MLDSA_ETA);
+#if MLDSA_ETA == 2
+  const __m256i sllvdidx = _mm256_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21);
+  __m256i f;
+  __m128i t;
+  uint32_t v;
+
+  for (i = 0; i < MLDSA_N / 8; i++)
+  {
+    f = _mm256_loadu_si256((const __m256i *)&a[8 * i]);
+    f = _mm256_sub_epi32(eta, f);
+    f = _mm256_sllv_epi32(f, sllvdidx);
+    t = _mm_or_si128(_mm256_castsi256_si128(f),
+                     _mm256_extracti128_si256(f, 1));
+    t = _mm_or_si128(t, _mm_srli_si128(t, 8));
+    t = _mm_or_si128(t, _mm_srli_si128(t, 4));
+    v = (uint32_t)_mm_cvtsi128_si32(t);
+
+    r[3 * i + 0] = v & 0xFF;
+    r[3 * i + 1] = (v >> 8) & 0xFF;
+    r[3 * i + 2] = (v >> 16) & 0xFF;
+  }
+#elif MLDSA_ETA == 4
+  unsigned int j;
+  __m256i f[8];
+
+  for (i = 0; i < MLDSA_N / 64; i++)
+  {
+    for (j = 0; j < 8; j++)
+    {
+      f[j] = _mm256_loadu_si256((const __m256i *)&a[64 * i + 8 * j]);
+      f[j] = _mm256_sub_epi32(eta, f[j]);
+    }
+    mld_pack4x64(&r[32 * i], f);
+  }
+#else /* MLDSA_ETA == 4 */
+#error "Invalid value of MLDSA_ETA"
+#endif /* MLDSA_ETA != 2 && MLDSA_ETA != 4 */
+}
+
+MLD_TARGET_AVX2
+void mld_polyeta_unpack_avx2(int32_t *r, const uint8_t *a)
+{
+  unsigned int i;
+  uint32_t v;
+  __m256i f;
+  const __m256i eta = _mm256_set1_epi32(MLDSA_ETA);
+#if MLDSA_ETA == 2
+  const __m256i srlvdidx = _mm256_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21);
+  const __m256i mask = _mm256_set1_epi32(7);
+#elif MLDSA_ETA == 4
+  const __m256i srlvdidx = _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28);
+  const __m256i mask = _mm256_set1_epi32(15);
+#else /* MLDSA_ETA == 4 */
+#error "Invalid value of MLDSA_ETA"
+#endif /* MLDSA_ETA != 2 && MLDSA_ETA != 4 */
+
+  /* Broadcast the bytes holding eight coefficients, shift each into place */
+  for (i = 0; i < MLDSA_N / 8; i++)
+  {
+#if MLDSA_ETA == 2
+    v = (uint32_t)a[3 * i + 0] | ((uint32_t)a[3 * i + 1] << 8) |
+        ((uint32_t)a[3 * i + 2] << 16);
+#else  /* MLDSA_ETA == 2 */
+    v = (uint32_t)a[4 * i + 0] | ((uint32_t)a[4 * i + 1] << 8) |
+        ((uint32_t)a[4 * i + 2] << 16) | ((uint32_t)a[4 * i + 3] << 24);
+#endif /* MLDSA_ETA != 2 */
+    f = _mm256_set1_epi32((int32_t)v);
+    f = _mm256_srlv_epi32(f, srlvdidx);
+    f = _mm256_and_si256(f, mask);
+    f = _mm256_sub_epi32(eta, f);
+    _mm256_storeu_si256((__m256i *)&r[8 * i], f);
+  }
+}
+
+MLD_TARGET_AVX2
+void mld_polyt1_pack_avx2(uint8_t *r, const int32_t *a)
+{
+  unsigned int i;
+  uint8_t buf[MLD_PACK_BLOCK_BYTES];
+  uint8_t *dst;
+  __m256i f;
+  __m128i t;
+  const __m256i sllvdidx = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+  const __m256i shufbidx0 =
+      _mm256_setr_epi8(0, 1, 8, 9, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                       -1, 0, 1, 8, 9, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                       -1, -1);
+  const __m256i shufbidx1 =
+      _mm256_setr_epi8(-1, 4, 5, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                       -1, -1, -1, 4, 5, 12, 13, -1, -1, -1, -1, -1, -1, -1,
+                       -1, -1, -1, -1);
+
+  for (i = 0; i < MLDSA_N / 8; i++)
+  {
+    dst = mld_pack_dst(buf, r, 10 * i, MLDSA_POLYT1_PACKEDBYTES);
+    f = _mm256_loadu_si256((const __m256i *)&a[8 * i]);
+    f = mld_pack8(f, sllvdidx, shufbidx0, shufbidx1);
+    t = _mm_or_si128(_mm256_castsi256_si128(f),
+                     _mm_bslli_si128(_mm256_extracti128_si256(f, 1), 5));
+    _mm_storeu_si128((__m128i *)dst, t);
+    mld_pack_flush(dst, buf, r, 10 * i, 10);
+  }
+}
+
+MLD_TARGET_AVX2
+void mld_polyt1_unpack_avx2(int32_t *r, const uint8_t *a)
+{
+  unsigned int i;
+  uint8_t buf[MLD_PACK_BLOCK_BYTES];
+  const uint8_t *src;
+  __m256i f;
+  const __m256i shufbidx =
+      _mm256_setr_epi8(0, 1, 2, 3, 1, 2, 3, 4, 2, 3, 4, 5, 3, 4, 5, 6, 0, 1, 2,
+                       3, 1, 2, 3, 4, 2, 3, 4, 5, 3, 4, 5, 6);
+  const __m256i srlvdidx = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+  const __m256i mask = _mm256_set1_epi32(0x3FF);
+
+  for (i = 0; i < MLDSA_N / 8; i++)
+  {
+    src = mld_unpack_src(buf, a, 10 * i, 10, MLDSA_POLYT1_PACKEDBYTES);
+    f = mld_unpack8(src, 5, shufbidx, srlvdidx, mask);
+    _mm256_storeu_si256((__m256i *)&r[8 * i], f);
+  }
+}
+
+MLD_TARGET_AVX2
+void mld_polyt0_pack_avx2(uint8_t *r, const int32_t *a)
+{
+  unsigned int i;
+  uint8_t buf[MLD_PACK_BLOCK_BYTES];
+  uint8_t *dst;
+  __m256i f;
+  __m128i t;
+  const __m256i offset = _mm256_set1_epi32(1 << (MLDSA_D - 1));
+  const __m256i sllvdidx = _mm256_setr_epi32(0, 5, 2, 7, 4, 1, 6, 3);
+  const __m256i shufbidx0 =
+      _mm256_setr_epi8(0, 1, -1, 8, 9, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                       -1, 0, 1, 2, 8, 9, 10, -1, -1, -1, -1, -1, -1, -1, -1,
+                       -1, -1);
+  const __m256i shufbidx1 =
+      _mm256_setr_epi8(-1, 4, 5, 6, 12, 13, 14, -1, -1, -1, -1, -1, -1, -1, -1,
+                       -1, -1, -1, 4, 5, -1, 12, 13, -1, -1, -1, -1, -1, -1,
+                       -1, -1, -1);
+
+  for (i = 0; i < MLDSA_N / 8; i++)
+  {
+    dst = mld_pack_dst(buf, r, 13 * i, MLDSA_POLYT0_PACKEDBYTES);
+    f = _mm256_loadu_si256((const __m256i *)&a[8 * i]);
+    f = _mm256_sub_epi32(offset, f);
+    f = mld_pack8(f, sllvdidx, shufbidx0, shufbidx1);
+    /* The halves share byte 6 of the block */
+    t = _mm_or_si128(_mm256_castsi256_si128(f),
+                     _mm_bslli_si128(_mm256_extracti128_si256(f, 1), 6));
+    _mm_storeu_si128((__m128i *)dst, t);
+    mld_pack_flush(dst, buf, r, 13 * i, 13);
+  }
+}
+
+MLD_TARGET_AVX2
+void mld_polyt0_unpack_avx2(int32_t *r, const uint8_t *a)
+{
+  unsigned int i;
+  uint8_t buf[MLD_PACK_BLOCK_BYTES];
+  const uint8_t *src;
+  __m256i f;
+  const __m256i offset = _mm256_set1_epi32(1 << (MLDSA_D - 1));
+  const __m256i shufbidx =
+      _mm256_setr_epi8(0, 1, 2, 3, 1, 2, 3, 4, 3, 4, 5, 6, 4, 5, 6, 7, 0, 1, 2,
+                       3, 2, 3, 4, 5, 3, 4, 5, 6, 5, 6, 7, 8);
+  const __m256i srlvdidx = _mm256_setr_epi32(0, 5, 2, 7, 4, 1, 6, 3);
+  const __m256i mask = _mm256_set1_epi32(0x1FFF);
+
+  for (i = 0; i < MLDSA_N / 8; i++)
+  {
+    src = mld_unpack_src(buf, a, 13 * i, 13, MLDSA_POLYT0_PACKEDBYTES);
+    f = mld_unpack8(src, 6, shufbidx, srlvdidx, mask);
+    f = _mm256_sub_epi32(offset, f);
+    _mm256_storeu_si256((__m256i *)&r[8 * i], f);
+  }
+}
+
+#if MLDSA_MODE == 2
+/* 18-bit coefficients; eight per 18-byte block, halves start at 0 and 9 */
+#define MLD_POLYZ_BITS 18
+#define MLD_POLYZ_HB 9
+#define MLD_POLYZ_SHIFTS 0, 2, 4, 6, 0, 2, 4, 6
+#define MLD_POLYZ_UNPACK_SHUFBIDX                                           \
+  0, 1, 2, 3, 2, 3, 4, 5, 4, 5, 6, 7, 6, 7, 8, 9, 0, 1, 2, 3, 2, 3, 4, 5, 4, \
+      5, 6, 7, 6, 7, 8, 9
+#define MLD_POLYZ_PACK_SHUFBIDX0                                              \
+  0, 1, 2, -1, 8, 9, 10, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 1, 2, -1, 8, \
+      9, 10, -1, -1, -1, -1, -1, -1, -1, -1, -1
+#define MLD_POLYZ_PACK_SHUFBIDX1                                              \
+  -1, -1, 4, 5, 6, -1, 12, 13, 14, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4, 5, \
+      6, -1, 12, 13, 14, -1, -1, -1, -1, -1, -1, -1
+#else /* MLDSA_MODE == 2 */
+/* 20-bit coefficients; eight per 20-byte block, halves start at 0 and 10 */
+#define MLD_POLYZ_BITS 20
+#define MLD_POLYZ_HB 10
+#define MLD_POLYZ_SHIFTS 0, 4, 0, 4, 0, 4, 0, 4
+#define MLD_POLYZ_UNPACK_SHUFBIDX                                           \
+  0, 1, 2, 3, 2, 3, 4, 5, 5, 6, 7, 8, 7, 8, 9, 10, 0, 1, 2, 3, 2, 3, 4, 5, 5, \
+      6, 7, 8, 7, 8, 9, 10
+#define MLD_POLYZ_PACK_SHUFBIDX0                                              \
+  0, 1, 2, -1, -1, 8, 9, 10, -1, -1, -1, -1, -1, -1, -1, -1, 0, 1, 2, -1, -1, \
+      8, 9, 10, -1, -1, -1, -1, -1, -1, -1, -1
+#define MLD_POLYZ_PACK_SHUFBIDX1                                              \
+  -1, -1, 4, 5, 6, -1, -1, 12, 13, 14, -1, -1, -1, -1, -1, -1, -1, -1, 4, 5, \
+      6, -1, -1, 12, 13, 14, -1, -1, -1, -1, -1, -1
+#endif /* MLDSA_MODE != 2 */
+
+MLD_TARGET_AVX2
+void mld_polyz_pack_avx2(uint8_t *r, const int32_t *a)
+{
+  unsigned int i;
+  uint8_t buf[MLD_PACK_BLOCK_BYTES];
+  uint8_t *dst;
+  __m256i f;
+  const __m256i gamma1 = _mm256_set1_epi32(MLDSA_GAMMA1);
+  const __m256i sllvdidx = _mm256_setr_epi32(MLD_POLYZ_SHIFTS);
+  const __m256i shufbidx0 = _mm256_setr_epi8(MLD_POLYZ_PACK_SHUFBIDX0);
+  const __m256i shufbidx1 = _mm256_setr_epi8(MLD_POLYZ_PACK_SHUFBIDX1);
+
+  for (i = 0; i < MLDSA_N / 8; i++)
+  {
+    dst = mld_pack_dst(buf, r, MLD_POLYZ_BITS * i, MLDSA_POLYZ_PACKEDBYTES);
+    f = _mm256_loadu_si256((const __m256i *)&a[8 * i]);
+    f = _mm256_sub_epi32(gamma1, f);
+    f = mld_pack8(f, sllvdidx, shufbidx0, shufbidx1);
+    /* The second store overwrites the trailing zeros of the first */
+    _mm_storeu_si128((__m128i *)dst, _mm256_castsi256_si128(f));
+    _mm_storeu_si128((__m128i *)(dst + MLD_POLYZ_HB),
+                     _mm256_extracti128_si256(f, 1));
+    mld_pack_flush(dst, buf, r, MLD_POLYZ_BITS * i, MLD_POLYZ_BITS);
+  }
+}
+
+MLD_TARGET_AVX2
+void mld_polyz_unpack_avx2(int32_t *r, const uint8_t *a)
+{
+  unsigned int i;
+  uint8_t buf[MLD_PACK_BLOCK_BYTES];
+  const uint8_t *src;
+  __m256i f;
+  const __m256i gamma1 = _mm256_set1_epi32(MLDSA_GAMMA1);
+  const __m256i shufbidx = _mm256_setr_epi8(MLD_POLYZ_UNPACK_SHUFBIDX);
+  const __m256i srlvdidx = _mm256_setr_epi32(MLD_POLYZ_SHIFTS);
+  const __m256i mask = _mm256_set1_epi32((1 << MLD_POLYZ_BITS) - 1);
+
+  for (i = 0; i < MLDSA_N / 8; i++)
+  {
+    src = mld_unpack_src(buf, a, MLD_POLYZ_BITS * i, MLD_POLYZ_BITS,
+                         MLDSA_POLYZ_PACKEDBYTES);
+    f = mld_unpack8(src, MLD_POLYZ_HB, shufbidx, srlvdidx, mask);
+    f = _mm256_sub_epi32(gamma1, f);
+    _mm256_storeu_si256((__m256i *)&r[8 * i], f);
+  }
+}
+
+MLD_TARGET_AVX2
+void mld_polyw1_pack_avx2(uint8_t *r, const int32_t *a)
+{
+  unsigned int i;
+#if MLDSA_MODE == 2
+  /* 6-bit coefficients; 32 coefficients per 24 bytes */
+  __m256i f0, f1, f2, f3;
+  const __m256i shift1 = _mm256_set1_epi16((64 << 8) + 1);
+  const __m256i shift2 = _mm256_set1_epi32((4096 << 16) + 1);
+  const __m256i shufdidx1 = _mm256_set_epi32(7, 3, 6, 2, 5, 1, 4, 0);
+  const __m256i shufdidx2 = _mm256_set_epi32(-1, -1, 6, 5, 4, 2, 1, 0);
+  const __m256i shufbidx =
+      _mm256_set_epi8(-1, -1, -1, -1, 14, 13, 12, 10, 9, 8, 6, 5, 4, 2, 1, 0,
+                      -1, -1, -1, -1, 14, 13, 12, 10, 9, 8, 6, 5, 4, 2, 1, 0);
+
+  for (i = 0; i < MLDSA_N / 32; i++)
+  {
+    f0 = _mm256_loadu_si256((const __m256i *)&a[32 * i + 0]);
+    f1 = _mm256_loadu_si256((const __m256i *)&a[32 * i + 8]);
+    f2 = _mm256_loadu_si256((const __m256i *)&a[32 * i + 16]);
+    f3 = _mm256_loadu_si256((const __m256i *)&a[32 * i + 24]);
+    f0 = _mm256_packus_epi32(f0, f1);
+    f1 = _mm256_packus_epi32(f2, f3);
+    f0 = _mm256_packus_epi16(f0, f1);
+    f0 = _mm256_maddubs_epi16(f0, shift1);
+    f0 = _mm256_madd_epi16(f0, shift2);
+    f0 = _mm256_permutevar8x32_epi32(f0, shufdidx1);
+    f0 = _mm256_shuffle_epi8(f0, shufbidx);
+    f0 = _mm256_permutevar8x32_epi32(f0, shufdidx2);
+    /* Store the 24 valid bytes only */
+    _mm_storeu_si128((__m128i *)&r[24 * i], _mm256_castsi256_si128(f0));
+    _mm_storel_epi64((__m128i *)&r[24 * i + 16],
+                     _mm256_extracti128_si256(f0, 1));
+  }
+#else  /* MLDSA_MODE == 2 */
+  /* 4-bit coefficients; 64 coefficients per 32 bytes */
+  unsigned int j;
+  __m256i f[8];
+
+  for (i = 0; i < MLDSA_N / 64; i++)
+  {
+    for (j = 0; j < 8; j++)
+    {
+      f[j] = _mm256_loadu_si256((const __m256i *)&a[64 * i + 8 * j]);
+    }
+    mld_pack4x64(&r[32 * i], f);
+  }
+#endif /* MLDSA_MODE != 2 */
+}
+
+#else /* MLD_ARITH_BACKEND_X86_64_DEFAULT */
+
+/* Avoid an empty translation unit */
+extern int MLD_NAMESPACE(empty_cu_poly_pack_avx2);
+
+#endif /* !MLD_ARITH_BACKEND_X86_64_DEFAULT */
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/*
+ * Based on the public domain AVX2 implementation of rejection sampling in
+ * the Dilithium reference repository https://github.com/pq-crystals/dilithium
+ * by Léo Ducas, Eike Kiltz, Tancrède Lepoint, Vadim Lyubashevsky, Gregor
+ * Seiler, Peter Schwabe and Damien Stehlé.
+ */
+
+#include "../../../common.h"
+
+#if defined(MLD_ARITH_BACKEND_X86_64_DEFAULT)
+
+#include <immintrin.h>
+#include <stdint.h>
+#include "arith_native_x86_64.h"
+
+/*
+ * Each iteration of the vector loop consumes 24 bytes of input and
+ * produces up to 8 coefficients. Since the 32-byte load reads 8 bytes
+ * beyond those consumed and the 32-byte store writes 8 coefficients
+ * irrespective of how many were accepted, the vector loop only runs while
+ * both input and output have sufficient room; the remainder is handled by
+ * the scalar loop.
+ */
+MLD_TARGET_AVX2
+unsigned int mld_rej_uniform_avx2(int32_t *r, unsigned int len,
+                                  const uint8_t *buf, unsigned int buflen)
+{
+  unsigned int ctr, pos;
+  uint32_t t, good;
+  __m256i d, tmp;
+  const __m256i bound = _mm256_set1_epi32(MLDSA_Q);
+  const __m256i mask = _mm256_set1_epi32(0x7FFFFF);
+  /* Spread 3-byte candidates into 32-bit lanes: after the 64-bit permute,
+   * the low 128-bit lane holds input bytes 0..15 and the high 128-bit lane
+   * holds input bytes 8..23. */
+  const __m256i idx8 =
+      _mm256_set_epi8(-1, 15, 14, 13, -1, 12, 11, 10, -1, 9, 8, 7, -1, 6, 5, 4,
+                      -1, 11, 10, 9, -1, 8, 7, 6, -1, 5, 4, 3, -1, 2, 1, 0);
+
+  ctr = pos = 0;
+  while (ctr + 8 <= len && pos + 32 <= buflen)
+  {
+    d = _mm256_loadu_si256((const __m256i *)&buf[pos]);
+    d = _mm256_permute4x64_epi64(d, 0x94);
+    d = _mm256_shuffle_epi8(d, idx8);
+    d = _mm256_and_si256(d, mask);
+    pos += 24;
+
+    /* Sign bit of d - MLDSA_Q is set iff d < MLDSA_Q */
+    tmp = _mm256_sub_epi32(d, bound);
+    good = (uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(tmp));
+    tmp = _mm256_cvtepu8_epi32(
+        _mm_loadl_epi64((const __m128i *)&mld_rej_uniform_table[good]));
+    d = _mm256_permutevar8x32_epi32(d, tmp);
+
+    _mm256_storeu_si256((__m256i *)&r[ctr], d);
+    ctr += (unsigned int)_mm_popcnt_u32(good);
+  }
+
+  while (ctr < len && pos + 3 <= buflen)
+  {
+    t = buf[pos++];
+    t |= (uint32_t)buf[pos++] << 8;
+    t |= (uint32_t)buf[pos++] << 16;
+    t &= 0x7FFFFF;
+
+    if (t < MLDSA_Q)
+    {
+      r[ctr++] = (int32_t)t;
+    }
+  }
+
+  return ctr;
+}
+
+#else /* MLD_ARITH_BACKEND_X86_64_DEFAULT */
+
+/* Avoid an empty translation unit */
+extern int MLD_NAMESPACE(empty_cu_rej_uniform_avx2);
+
+#endif /* !MLD_ARITH_BACKEND_X86_64_DEFAULT */
@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "../../../common.h"
+
+#if defined(MLD_ARITH_BACKEND_X86_64_DEFAULT)
+
+#include <stdint.h>
+#include "arith_native_x86_64.h"
+
+/*
+ * Lookup table used by rejection sampling of the public matrix.
+ * Row i lists, in increasing order, the indices of the bits set in i,
+ * padded with zeros. It is used as a permutation compressing the accepted
+ * lanes of a 256-bit vector of 8 candidates to its low end.
+ */
+MLD_ALIGN const uint8_t mld_rej_uniform_table[256][8] = {
+    {0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 0, 0, 0, 0, 0, 0},
+    {2, 0, 0, 0, 0, 0, 0, 0},
+    {0, 2, 0, 0, 0, 0, 0, 0},
+    {1, 2, 0, 0, 0, 0, 0, 0},
+    {0, 1, 2, 0, 0, 0, 0, 0},
+    {3, 0, 0, 0, 0, 0, 0, 0},
+    {0, 3, 0, 0, 0, 0, 0, 0},
+    {1, 3, 0, 0, 0, 0, 0, 0},
+    {0, 1, 3, 0, 0, 0, 0, 0},
+    {2, 3, 0, 0, 0, 0, 0, 0},
+    {0, 2, 3, 0, 0, 0, 0, 0},
+    {1, 2, 3, 0, 0, 0, 0, 0},
+    {0, 1, 2, 3, 0, 0, 0, 0},
+    {4, 0, 0, 0, 0, 0, 0, 0},
+    {0, 4, 0, 0, 0, 0, 0, 0},
+    {1, 4, 0, 0, 0, 0, 0, 0},
+    {0, 1, 4, 0, 0, 0, 0, 0},
+    {2, 4, 0, 0, 0, 0, 0, 0},
+    {0, 2, 4, 0, 0, 0, 0, 0},
+    {1, 2, 4, 0, 0, 0, 0, 0},
+    {0, 1, 2, 4, 0, 0, 0, 0},
+    {3, 4, 0, 0, 0, 0, 0, 0},
+    {0, 3, 4, 0, 0, 0, 0, 0},
+    {1, 3, 4, 0, 0, 0, 0, 0},
+    {0, 1, 3, 4, 0, 0, 0, 0},
+    {2, 3, 4, 0, 0, 0, 0, 0},
+    {0, 2, 3, 4, 0, 0, 0, 0},
+    {1, 2, 3, 4, 0, 0, 0, 0},
+    {0, 1, 2, 3, 4, 0, 0, 0},
+    {5, 0, 0, 0, 0, 0, 0, 0},
+    {0, 5, 0, 0, 0, 0, 0, 0},
+    {1, 5, 0, 0, 0, 0, 0, 0},
+    {0, 1, 5, 0, 0, 0, 0, 0},
+    {2, 5, 0, 0, 0, 0, 0, 0},
+    {0, 2, 5, 0, 0, 0, 0, 0},
+    {1, 2, 5, 0, 0, 0, 0, 0},
+    {0, 1, 2, 5, 0, 0, 0, 0},
+    {3, 5, 0, 0, 0, 0, 0, 0},
+    {0, 3, 5, 0, 0, 0, 0, 0},
+    {1, 3, 5, 0, 0, 0, 0, 0},
+    {0, 1, 3, 5, 0, 0, 0, 0},
+    {2, 3, 5, 0, 0, 0, 0, 0},
+    {0, 2, 3, 5, 0, 0, 0, 0},
+    {1, 2, 3, 5, 0, 0, 0, 0},
+    {0, 1, 2, 3, 5, 0, 0, 0},
+    {4, 5, 0, 0, 0, 0, 0, 0},
+    {0, 4, 5, 0, 0, 0, 0, 0},
+    {1, 4, 5, 0, 0, 0, 0, 0},
+    {0, 1, 4, 5, 0, 0, 0, 0},
+    {2, 4, 5, 0, 0, 0, 0, 0},
+    {0, 2, 4, 5, 0, 0, 0, 0},
+    {1, 2, 4, 5, 0, 0, 0, 0},
+    {0, 1, 2, 4, 5, 0, 0, 0},
+    {3, 4, 5, 0, 0, 0, 0, 0},
+    {0, 3, 4, 5, 0, 0, 0, 0},
+    {1, 3, 4, 5, 0, 0, 0, 0},
+    {0, 1, 3, 4, 5, 0, 0, 0},
+    {2, 3, 4, 5, 0, 0, 0, 0},
+    {0, 2, 3, 4, 5, 0, 0, 0},
+    {1, 2, 3, 4, 5, 0, 0, 0},
+    {0, 1, 2, 3, 4, 5, 0, 0},
+    {6, 0, 0, 0, 0, 0, 0, 0},
+    {0, 6, 0, 0, 0, 0, 0, 0},
+    {1, 6, 0, 0, 0, 0, 0, 0},
+    {0, 1, 6, 0, 0, 0, 0, 0},
+    {2, 6, 0, 0, 0, 0, 0, 0},
+    {0, 2, 6, 0, 0, 0, 0, 0},
+    {1, 2, 6, 0, 0, 0, 0, 0},
+    {0, 1, 2, 6, 0, 0, 0, 0},
+    {3, 6, 0, 0, 0, 0, 0, 0},
+    {0, 3, 6, 0, 0, 0, 0, 0},
+    {1, 3, 6, 0, 0, 0, 0, 0},
+    {0, 1, 3, 6, 0, 0, 0, 0},
+    {2, 3, 6, 0, 0, 0, 0, 0},
+    {0, 2, 3, 6, 0, 0, 0, 0},
+    {1, 2, 3, 6, 0, 0, 0, 0},
+    {0, 1, 2, 3, 6, 0, 0, 0},
+    {4, 6, 0, 0, 0, 0, 0, 0},
+    {0, 4, 6, 0, 0, 0, 0, 0},
+    {1, 4, 6, 0, 0, 0, 0, 0},
+    {0, 1, 4, 6, 0, 0, 0, 0},
+    {2, 4, 6, 0, 0, 0, 0, 0},
+    {0, 2, 4, 6, 0, 0, 0, 0},
+    {1, 2, 4, 6, 0, 0, 0, 0},
+    {0, 1, 2, 4, 6, 0, 0, 0},
+    {3, 4, 6, 0, 0, 0, 0, 0},
+    {0, 3, 4, 6, 0, 0, 0, 0},
+    {1, 3, 4, 6, 0, 0, 0, 0},
+    {0, 1, 3, 4, 6, 0, 0, 0},
+    {2, 3, 4, 6, 0, 0, 0, 0},
+    {0, 2, 3, 4, 6, 0, 0, 0},
+    {1, 2, 3, 4, 6, 0, 0, 0},
+    {0, 1, 2, 3, 4, 6, 0, 0},
+    {5, 6, 0, 0, 0, 0, 0, 0},
+    {0, 5, 6, 0, 0, 0, 0, 0},
+    {1, 5, 6, 0, 0, 0, 0, 0},
+    {0, 1, 5, 6, 0, 0, 0, 0},
+    {2, 5, 6, 0, 0, 0, 0, 0},
+    {0, 2, 5, 6, 0, 0, 0, 0},
+    {1, 2, 5, 6, 0, 0, 0, 0},
+    {0, 1, 2, 5, 6, 0, 0, 0},
+    {3, 5, 6, 0, 0, 0, 0, 0},
+    {0, 3, 5, 6, 0, 0, 0, 0},
+    {1, 3, 5, 6, 0, 0, 0, 0},
+    {0, 1, 3, 5, 6, 0, 0, 0},
+    {2, 3, 5, 6, 0, 0, 0, 0},
+    {0, 2, 3, 5, 6, 0, 0, 0},
+    {1, 2, 3, 5, 6, 0, 0, 0},
+    {0, 1, 2, 3, 5, 6, 0, 0},
+    {4, 5, 6, 0, 0, 0, 0, 0},
+    {0, 4, 5, 6, 0, 0, 0, 0},
+    {1, 4, 5, 6, 0, 0, 0, 0},
+    {0, 1, 4, 5, 6, 0, 0, 0},
+    {2, 4, 5, 6, 0, 0, 0, 0},
+    {0, 2, 4, 5, 6, 0, 0, 0},
+    {1, 2, 4, 5, 6, 0, 0, 0},
+    {0, 1, 2, 4, 5, 6, 0, 0},
+    {3, 4, 5, 6, 0, 0, 0, 0},
+    {0, 3, 4, 5, 6, 0, 0, 0},
+    {1, 3, 4, 5, 6, 0, 0, 0},
+    {0, 1, 3, 4, 5, 6, 0, 0},
+    {2, 3, 4, 5, 6, 0, 0, 0},
+    {0, 2, 3, 4, 5, 6, 0, 0},
+    {1, 2, 3, 4, 5, 6, 0, 0},
+    {0, 1, 2, 3, 4, 5, 6, 0},
+    {7, 0, 0, 0, 0, 0, 0, 0},
+    {0, 7, 0, 0, 0, 0, 0, 0},
+    {1, 7, 0, 0, 0, 0, 0, 0},
+    {0, 1, 7, 0, 0, 0, 0, 0},
+    {2, 7, 0, 0, 0, 0, 0, 0},
+    {0, 2, 7, 0, 0, 0, 0, 0},
+    {1, 2, 7, 0, 0, 0, 0, 0},
+    {0, 1, 2, 7, 0, 0, 0, 0},
+    {3, 7, 0, 0, 0, 0, 0, 0},
+    {0, 3, 7, 0, 0, 0, 0, 0},
+    {1, 3, 7, 0, 0, 0, 0, 0},
+    {0, 1, 3, 7, 0, 0, 0, 0},
+    {2, 3, 7, 0, 0, 0, 0, 0},
+    {0, 2, 3, 7, 0, 0, 0, 0},
+    {1, 2, 3, 7, 0, 0, 0, 0},
+    {0, 1, 2, 3, 7, 0, 0, 0},
+    {4, 7, 0, 0, 0, 0, 0, 0},
+    {0, 4, 7, 0, 0, 0, 0, 0},
+    {1, 4, 7, 0, 0, 0, 0, 0},
+    {0, 1, 4, 7, 0, 0, 0, 0},
+    {2, 4, 7, 0, 0, 0, 0, 0},
+    {0, 2, 4, 7, 0, 0, 0, 0},
+    {1, 2, 4, 7, 0, 0, 0, 0},
+    {0, 1, 2, 4, 7, 0, 0, 0},
+    {3, 4, 7, 0, 0, 0, 0, 0},
+    {0, 3, 4, 7, 0, 0, 0, 0},
+    {1, 3, 4, 7, 0, 0, 0, 0},
+    {0, 1, 3, 4, 7, 0, 0, 0},
+    {2, 3, 4, 7, 0, 0, 0, 0},
+    {0, 2, 3, 4, 7, 0, 0, 0},
+    {1, 2, 3, 4, 7, 0, 0, 0},
+    {0, 1, 2, 3, 4, 7, 0, 0},
+    {5, 7, 0, 0, 0, 0, 0, 0},
+    {0, 5, 7, 0, 0, 0, 0, 0},
+    {1, 5, 7, 0, 0, 0, 0, 0},
+    {0, 1, 5, 7, 0, 0, 0, 0},
+    {2, 5, 7, 0, 0, 0, 0, 0},
+    {0, 2, 5, 7, 0, 0, 0, 0},
+    {1, 2, 5, 7, 0, 0, 0, 0},
+    {0, 1, 2, 5, 7, 0, 0, 0},
+    {3, 5, 7, 0, 0, 0, 0, 0},
+    {0, 3, 5, 7, 0, 0, 0, 0},
+    {1, 3, 5, 7, 0, 0, 0, 0},
+    {0, 1, 3, 5, 7, 0, 0, 0},
+    {2, 3, 5, 7, 0, 0, 0, 0},
+    {0, 2, 3, 5, 7, 0, 0, 0},
+    {1, 2, 3, 5, 7, 0, 0, 0},
+    {0, 1, 2, 3, 5, 7, 0, 0},
+    {4, 5, 7, 0, 0, 0, 0, 0},
+    {0, 4, 5, 7, 0, 0, 0, 0},
+    {1, 4, 5, 7, 0, 0, 0, 0},
+    {0, 1, 4, 5, 7, 0, 0, 0},
+    {2, 4, 5, 7, 0, 0, 0, 0},
+    {0, 2, 4, 5, 7, 0, 0, 0},
+    {1, 2, 4, 5, 7, 0, 0, 0},
+    {0, 1, 2, 4, 5, 7, 0, 0},
+    {3, 4, 5, 7, 0, 0, 0, 0},
+    {0, 3, 4, 5, 7, 0, 0, 0},
+    {1, 3, 4, 5, 7, 0, 0, 0},
+    {0, 1, 3, 4, 5, 7, 0, 0},
+    {2, 3, 4, 5, 7, 0, 0, 0},
+    {0, 2, 3, 4, 5, 7, 0, 0},
+    {1, 2, 3, 4, 5, 7, 0, 0},
+    {0, 1, 2, 3, 4, 5, 7, 0},
+    {6, 7, 0, 0, 0, 0, 0, 0},
+    {0, 6, 7, 0, 0, 0, 0, 0},
+    {1, 6, 7, 0, 0, 0, 0, 0},
+    {0, 1, 6, 7, 0, 0, 0, 0},
+    {2, 6, 7, 0, 0, 0, 0, 0},
+    {0, 2, 6, 7, 0, 0, 0, 0},
+    {1, 2, 6, 7, 0, 0, 0, 0},
+    {0, 1, 2, 6, 7, 0, 0, 0},
+    {3, 6, 7, 0, 0, 0, 0, 0},
+    {0, 3, 6, 7, 0, 0, 0, 0},
+    {1, 3, 6, 7, 0, 0, 0, 0},
+    {0, 1, 3, 6, 7, 0, 0, 0},
+    {2, 3, 6, 7, 0, 0, 0, 0},
+    {0, 2, 3, 6, 7, 0, 0, 0},
+    {1, 2, 3, 6, 7, 0, 0, 0},
+    {0, 1, 2, 3, 6, 7, 0, 0},
+    {4, 6, 7, 0, 0, 0, 0, 0},
+    {0, 4, 6, 7, 0, 0, 0, 0},
+    {1, 4, 6, 7, 0, 0, 0, 0},
+    {0, 1, 4, 6, 7, 0, 0, 0},
+    {2, 4, 6, 7, 0, 0, 0, 0},
+    {0, 2, 4, 6, 7, 0, 0, 0},
+    {1, 2, 4, 6, 7, 0, 0, 0},
+    {0, 1, 2, 4, 6, 7, 0, 0},
+    {3, 4, 6, 7, 0, 0, 0, 0},
+    {0, 3, 4, 6, 7, 0, 0, 0},
+    {1, 3, 4, 6, 7, 0, 0, 0},
+    {0, 1, 3, 4, 6, 7, 0, 0},
+    {2, 3, 4, 6, 7, 0, 0, 0},
+    {0, 2, 3, 4, 6, 7, 0, 0},
+    {1, 2, 3, 4, 6, 7, 0, 0},
+    {0, 1, 2, 3, 4, 6, 7, 0},
+    {5, 6, 7, 0, 0, 0, 0, 0},
+    {0, 5, 6, 7, 0, 0, 0, 0},
+    {1, 5, 6, 7, 0, 0, 0, 0},
+    {0, 1, 5, 6, 7, 0, 0, 0},
+    {2, 5, 6, 7, 0, 0, 0, 0},
+    {0, 2, 5, 6, 7, 0, 0, 0},
+    {1, 2, 5, 6, 7, 0, 0, 0},
+    {0, 1, 2, 5, 6, 7, 0, 0},
+    {3, 5, 6, 7, 0, 0, 0, 0},
+    {0, 3, 5, 6, 7, 0, 0, 0},
+    {1, 3, 5, 6, 7, 0, 0, 0},
+    {0, 1, 3, 5, 6, 7, 0, 0},
+    {2, 3, 5, 6, 7, 0, 0, 0},
+    {0, 2, 3, 5, 6, 7, 0, 0},
+    {1, 2, 3, 5, 6, 7, 0, 0},
+    {0, 1, 2, 3, 5, 6, 7, 0},
+    {4, 5, 6, 7, 0, 0, 0, 0},
+    {0, 4, 5, 6, 7, 0, 0, 0},
+    {1, 4, 5, 6, 7, 0, 0, 0},
+    {0, 1, 4, 5, 6, 7, 0, 0},
+    {2, 4, 5, 6, 7, 0, 0, 0},
+    {0, 2, 4, 5, 6, 7, 0, 0},
+    {1, 2, 4, 5, 6, 7, 0, 0},
+    {0, 1, 2, 4, 5, 6, 7, 0},
+    {3, 4, 5, 6, 7, 0, 0, 0},
+    {0, 3, 4, 5, 6, 7, 0, 0},
+    {1, 3, 4, 5, 6, 7, 0, 0},
+    {0, 1, 3, 4, 5, 6, 7, 0},
+    {2, 3, 4, 5, 6, 7, 0, 0},
+    {0, 2, 3, 4, 5, 6, 7, 0},
+    {1, 2, 3, 4, 5, 6, 7, 0},
+    {0, 1, 2, 3, 4, 5, 6, 7},
+};
+
+#else /* MLD_ARITH_BACKEND_X86_64_DEFAULT */
+
+/* Avoid an empty translation unit */
+extern int MLD_NAMESPACE(empty_cu_rej_uniform_table);
+
+#endif /* !MLD_ARITH_BACKEND_X86_64_DEFAULT */
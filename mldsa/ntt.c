@@ -19,7 +19,6 @@ __contract__(
 
 #include "zetas.inc"
 
-
 /* mld_ntt_butterfly_block()
  *
  * Computes a block CT butterflies with a fixed twiddle factor,
@@ -127,6 +126,13 @@ void ntt(int32_t a[MLDSA_N])
 {
   unsigned int layer;
 
+#if defined(MLD_USE_NATIVE_NTT)
+  if (ntt_native(a) == MLD_NATIVE_FUNC_SUCCESS)
+  {
+    return;
+  }
+#endif /* MLD_USE_NATIVE_NTT */
+
   for (layer = 1; layer < 9; layer++)
   __loop__(
     invariant(1 <= layer && layer <= 9)
@@ -141,7 +147,6 @@ void ntt(int32_t a[MLDSA_N])
   /* are bounded in magnitude by 9 * MLDSA_Q                 */
 }
 
-
 /*************************************************
  * Name:        invntt_tomont
  *
@@ -159,6 +164,13 @@ void invntt_tomont(int32_t a[MLDSA_N])
   int32_t t, zeta;
   const int32_t f = 41978; /* mont^2/256 */
 
+#if defined(MLD_USE_NATIVE_INTT)
+  if (intt_native(a) == MLD_NATIVE_FUNC_SUCCESS)
+  {
+    return;
+  }
+#endif /* MLD_USE_NATIVE_INTT */
+
   k = 256;
   for (len = 1; len < MLDSA_N; len <<= 1)
   {
@@ -72,6 +72,29 @@
 #define CRYPTO_SECRETKEYBYTES                                                  \
   (2 * MLDSA_SEEDBYTES + MLDSA_TRBYTES + MLDSA_L * MLDSA_POLYETA_PACKEDBYTES + \
    MLDSA_K * MLDSA_POLYETA_PACKEDBYTES + MLDSA_K * MLDSA_POLYT0_PACKEDBYTES)
+/* Size of polymat, see polyvec.h */
+#if !defined(MLD_CONFIG_REDUCE_RAM)
+#define MLD_POLYMAT_BYTES (4 * MLDSA_N * MLDSA_K * MLDSA_L)
+#else  /* !MLD_CONFIG_REDUCE_RAM */
+#define MLD_POLYMAT_BYTES MLDSA_SEEDBYTES
+#endif /* MLD_CONFIG_REDUCE_RAM */
+/* Upper bound on the size of mld_expanded_sk, see sign.h; 208 bounds the
+ * size of keccak_state, which depends on the platform, and 8 the size of
+ * the sparse_challenge flag including padding */
+#define CRYPTO_EXPANDEDSKBYTES                     \
+  (MLDSA_SEEDBYTES + 2 * 208 + MLD_POLYMAT_BYTES + \
+   4 * MLDSA_N * (MLDSA_L + 2 * MLDSA_K) + 8)
+/* Upper bound on the size of mld_expanded_pk, see sign.h */
+#define CRYPTO_EXPANDEDPKBYTES \
+  (208 + MLD_POLYMAT_BYTES + 4 * MLDSA_N * MLDSA_K)
+/* Upper bound on the size of mld_workspace, see sign.h; determined by its
+ * signing member */
+#define CRYPTO_WORKSPACEBYTES \
+  (CRYPTO_EXPANDEDSKBYTES + 4 * MLDSA_N * (2 * MLDSA_L + 3 * MLDSA_K + 1))
+/* Upper bound on the size of mld_sign_ctx, see sign.h */
+#define CRYPTO_SIGNCTXBYTES (208 + CRYPTO_SECRETKEYBYTES)
+/* Upper bound on the size of mld_verify_ctx, see sign.h */
+#define CRYPTO_VERIFYCTXBYTES (208 + CRYPTO_PUBLICKEYBYTES)
 #define CRYPTO_BYTES                                       \
   (MLDSA_CTILDEBYTES + MLDSA_L * MLDSA_POLYZ_PACKEDBYTES + \
    MLDSA_POLYVECH_PACKEDBYTES)
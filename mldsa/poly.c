@@ -199,7 +199,7 @@ int poly_chknorm(const poly *a, int32_t B)
 }
 
 /*************************************************
- * Name:        rej_uniform
+ * Name:        rej_uniform_c
  *
  * Description: Sample uniformly random coefficients in [0, MLDSA_Q-1] by
  *              performing rejection sampling on array of random bytes.
@@ -214,8 +214,8 @@ int poly_chknorm(const poly *a, int32_t B)
  **************************************************/
 #define POLY_UNIFORM_NBLOCKS \
   ((768 + STREAM128_BLOCKBYTES - 1) / STREAM128_BLOCKBYTES)
-static unsigned int rej_uniform(int32_t *a, unsigned int len,
-                                const uint8_t *buf, unsigned int buflen)
+static unsigned int rej_uniform_c(int32_t *a, unsigned int len,
+                                  const uint8_t *buf, unsigned int buflen)
 __contract__(
   requires(len <= buflen && len <= MLDSA_N)
   requires(buflen <= (POLY_UNIFORM_NBLOCKS * STREAM128_BLOCKBYTES) && buflen % 3 == 0)
@@ -252,6 +252,32 @@ __contract__(
   return ctr;
 }
 
+/* Dispatches to the native backend, if present, and to rej_uniform_c
+ * otherwise or if the backend does not support the given lengths. */
+static unsigned int rej_uniform(int32_t *a, unsigned int len,
+                                const uint8_t *buf, unsigned int buflen)
+__contract__(
+  requires(len <= buflen && len <= MLDSA_N)
+  requires(buflen <= (POLY_UNIFORM_NBLOCKS * STREAM128_BLOCKBYTES) && buflen % 3 == 0)
+  requires(memory_no_alias(a, sizeof(int32_t) * len))
+  requires(memory_no_alias(buf, buflen))
+  assigns(memory_slice(a, sizeof(int32_t) * len))
+  ensures(return_value <= len)
+  ensures(array_bound(a, 0, return_value, 0, MLDSA_Q))
+)
+{
+#if defined(MLD_USE_NATIVE_REJ_UNIFORM)
+  int ret;
+  ret = rej_uniform_native(a, len, buf, buflen);
+  if (ret != MLD_NATIVE_FUNC_FALLBACK)
+  {
+    return (unsigned int)ret;
+  }
+#endif /* MLD_USE_NATIVE_REJ_UNIFORM */
+
+  return rej_uniform_c(a, len, buf, buflen);
+}
+
 void poly_uniform(poly *a, const uint8_t seed[MLDSA_SEEDBYTES], uint16_t nonce)
 {
   unsigned int i, ctr, off;
@@ -278,6 +304,50 @@ void poly_uniform(poly *a, const uint8_t seed[MLDSA_SEEDBYTES], uint16_t nonce)
   }
 }
 
+void poly_uniform_4x(poly *vec0, poly *vec1, poly *vec2, poly *vec3,
+                     const uint8_t seed[MLDSA_SEEDBYTES], uint16_t nonce0,
+                     uint16_t nonce1, uint16_t nonce2, uint16_t nonce3)
+{
+  /* Temporary buffers for XOF output before rejection sampling */
+  uint8_t buf[4][POLY_UNIFORM_NBLOCKS * STREAM128_BLOCKBYTES];
+  unsigned int ctr[4];
+  unsigned int buflen;
+  stream128x4_state state;
+
+  stream128x4_init(&state, seed, nonce0, nonce1, nonce2, nonce3);
+  stream128x4_squeezeblocks(buf[0], buf[1], buf[2], buf[3],
+                            POLY_UNIFORM_NBLOCKS, &state);
+
+  /*
+   * Since STREAM128_BLOCKBYTES is divisible by 3, there are no leftover
+   * bytes to carry over between blocks, unlike in poly_uniform().
+   */
+  buflen = POLY_UNIFORM_NBLOCKS * STREAM128_BLOCKBYTES;
+  ctr[0] = rej_uniform(vec0->coeffs, MLDSA_N, buf[0], buflen);
+  ctr[1] = rej_uniform(vec1->coeffs, MLDSA_N, buf[1], buflen);
+  ctr[2] = rej_uniform(vec2->coeffs, MLDSA_N, buf[2], buflen);
+  ctr[3] = rej_uniform(vec3->coeffs, MLDSA_N, buf[3], buflen);
+
+  /*
+   * So long as not all entries have been generated, squeeze
+   * one more block a time until we're done.
+   */
+  buflen = STREAM128_BLOCKBYTES;
+  while (ctr[0] < MLDSA_N || ctr[1] < MLDSA_N || ctr[2] < MLDSA_N ||
+         ctr[3] < MLDSA_N)
+  {
+    stream128x4_squeezeblocks(buf[0], buf[1], buf[2], buf[3], 1, &state);
+    ctr[0] += rej_uniform(vec0->coeffs + ctr[0], MLDSA_N - ctr[0], buf[0],
+                          buflen);
+    ctr[1] += rej_uniform(vec1->coeffs + ctr[1], MLDSA_N - ctr[1], buf[1],
+                          buflen);
+    ctr[2] += rej_uniform(vec2->coeffs + ctr[2], MLDSA_N - ctr[2], buf[2],
+                          buflen);
+    ctr[3] += rej_uniform(vec3->coeffs + ctr[3], MLDSA_N - ctr[3], buf[3],
+                          buflen);
+  }
+}
+
 /*************************************************
  * Name:        rej_eta
  *
@@ -388,17 +458,41 @@ void poly_uniform_gamma1(poly *a, const uint8_t seed[MLDSA_CRHBYTES],
   polyz_unpack(a, buf);
 }
 
-void poly_challenge(poly *c, const uint8_t seed[MLDSA_CTILDEBYTES])
+void poly_uniform_gamma1_4x(poly *a0, poly *a1, poly *a2, poly *a3,
+                            const uint8_t seed[MLDSA_CRHBYTES],
+                            uint16_t nonce0, uint16_t nonce1, uint16_t nonce2,
+                            uint16_t nonce3)
+{
+  uint8_t buf[4][POLY_UNIFORM_GAMMA1_NBLOCKS * STREAM256_BLOCKBYTES];
+  stream256x4_state state;
+
+  stream256x4_init(&state, seed, nonce0, nonce1, nonce2, nonce3);
+  stream256x4_squeezeblocks(buf[0], buf[1], buf[2], buf[3],
+                            POLY_UNIFORM_GAMMA1_NBLOCKS, &state);
+  polyz_unpack(a0, buf[0]);
+  polyz_unpack(a1, buf[1]);
+  polyz_unpack(a2, buf[2]);
+  polyz_unpack(a3, buf[3]);
+}
+
+/*************************************************
+ * Name:        mld_poly_challenge_sample
+ *
+ * Description: Sampling part of poly_challenge. Samples polynomial with
+ *              MLDSA_TAU nonzero coefficients in {-1,1} from the first
+ *              block of SHAKE256 output and, if needed, further blocks
+ *              squeezed from the given state.
+ *
+ * Arguments:   - poly *c: pointer to output polynomial
+ *              - uint8_t buf[]: first block of SHAKE256 output; clobbered
+ *              - keccak_state *state: SHAKE256 state positioned after the
+ *                first block
+ **************************************************/
+static void mld_poly_challenge_sample(poly *c, uint8_t buf[SHAKE256_RATE],
+                                      keccak_state *state)
 {
   unsigned int i, b, pos;
   uint64_t signs;
-  uint8_t buf[SHAKE256_RATE];
-  keccak_state state;
-
-  shake256_init(&state);
-  shake256_absorb(&state, seed, MLDSA_CTILDEBYTES);
-  shake256_finalize(&state);
-  shake256_squeezeblocks(buf, 1, &state);
 
   signs = 0;
   for (i = 0; i < 8; ++i)
@@ -417,7 +511,7 @@ void poly_challenge(poly *c, const uint8_t seed[MLDSA_CTILDEBYTES])
     {
       if (pos >= SHAKE256_RATE)
       {
-        shake256_squeezeblocks(buf, 1, &state);
+        shake256_squeezeblocks(buf, 1, state);
         pos = 0;
       }
 
@@ -430,11 +524,101 @@ void poly_challenge(poly *c, const uint8_t seed[MLDSA_CTILDEBYTES])
   }
 }
 
+void poly_challenge(poly *c, const uint8_t seed[MLDSA_CTILDEBYTES])
+{
+  uint8_t buf[SHAKE256_RATE];
+  keccak_state state;
+
+  shake256_init(&state);
+  shake256_absorb(&state, seed, MLDSA_CTILDEBYTES);
+  shake256_finalize(&state);
+  shake256_squeezeblocks(buf, 1, &state);
+
+  mld_poly_challenge_sample(c, buf, &state);
+}
+
+void poly_challenge_4x(poly *c0, poly *c1, poly *c2, poly *c3,
+                       const uint8_t seed0[MLDSA_CTILDEBYTES],
+                       const uint8_t seed1[MLDSA_CTILDEBYTES],
+                       const uint8_t seed2[MLDSA_CTILDEBYTES],
+                       const uint8_t seed3[MLDSA_CTILDEBYTES])
+{
+  uint8_t buf[4][SHAKE256_RATE];
+  keccakx4_state statex4;
+  keccak_state state;
+
+  shake256x4_absorb_once(&statex4, seed0, seed1, seed2, seed3,
+                         MLDSA_CTILDEBYTES);
+  shake256x4_squeezeblocks(buf[0], buf[1], buf[2], buf[3], 1, &statex4);
+
+  /*
+   * The first block almost always suffices. In the rare case that it does
+   * not, the remaining output of that instance is squeezed individually.
+   */
+  shake256x4_extract(&state, &statex4, 0);
+  mld_poly_challenge_sample(c0, buf[0], &state);
+  shake256x4_extract(&state, &statex4, 1);
+  mld_poly_challenge_sample(c1, buf[1], &state);
+  shake256x4_extract(&state, &statex4, 2);
+  mld_poly_challenge_sample(c2, buf[2], &state);
+  shake256x4_extract(&state, &statex4, 3);
+  mld_poly_challenge_sample(c3, buf[3], &state);
+}
+
+void poly_challenge_to_sparse(poly_challenge_sparse *s, const poly *c)
+{
+  unsigned int i, n;
+
+  n = 0;
+  for (i = 0; i < MLDSA_N && n < MLDSA_TAU; ++i)
+  {
+    if (c->coeffs[i] != 0)
+    {
+      s->pos[n] = (uint8_t)i;
+      s->sign[n] = (int8_t)c->coeffs[i];
+      n++;
+    }
+  }
+}
+
+void poly_sparse_mul(poly *r, const poly_challenge_sparse *c, const poly *a)
+{
+  unsigned int i, j, pos;
+  int32_t sign;
+
+  for (j = 0; j < MLDSA_N; ++j)
+  {
+    r->coeffs[j] = 0;
+  }
+
+  /* r += sign * X^pos * a, where X^N = -1 */
+  for (i = 0; i < MLDSA_TAU; ++i)
+  {
+    pos = c->pos[i];
+    sign = c->sign[i];
+    for (j = 0; j < pos; ++j)
+    {
+      r->coeffs[j] -= sign * a->coeffs[j + MLDSA_N - pos];
+    }
+    for (j = pos; j < MLDSA_N; ++j)
+    {
+      r->coeffs[j] += sign * a->coeffs[j - pos];
+    }
+  }
+}
+
 void polyeta_pack(uint8_t *r, const poly *a)
 {
   unsigned int i;
   uint8_t t[8];
 
+#if defined(MLD_USE_NATIVE_POLYETA_PACK)
+  if (polyeta_pack_native(r, a->coeffs) == MLD_NATIVE_FUNC_SUCCESS)
+  {
+    return;
+  }
+#endif /* MLD_USE_NATIVE_POLYETA_PACK */
+
 #if MLDSA_ETA == 2
   for (i = 0; i < MLDSA_N / 8; ++i)
   __loop__(
@@ -472,6 +656,13 @@ void polyeta_unpack(poly *r, const uint8_t *a)
 {
   unsigned int i;
 
+#if defined(MLD_USE_NATIVE_POLYETA_UNPACK)
+  if (polyeta_unpack_native(r->coeffs, a) == MLD_NATIVE_FUNC_SUCCESS)
+  {
+    return;
+  }
+#endif /* MLD_USE_NATIVE_POLYETA_UNPACK */
+
 #if MLDSA_ETA == 2
   for (i = 0; i < MLDSA_N / 8; ++i)
   __loop__(
@@ -516,6 +707,13 @@ void polyt1_pack(uint8_t *r, const poly *a)
 {
   unsigned int i;
 
+#if defined(MLD_USE_NATIVE_POLYT1_PACK)
+  if (polyt1_pack_native(r, a->coeffs) == MLD_NATIVE_FUNC_SUCCESS)
+  {
+    return;
+  }
+#endif /* MLD_USE_NATIVE_POLYT1_PACK */
+
   for (i = 0; i < MLDSA_N / 4; ++i)
   __loop__(
     invariant(i <= MLDSA_N/4))
@@ -535,6 +733,13 @@ void polyt1_unpack(poly *r, const uint8_t *a)
 {
   unsigned int i;
 
+#if defined(MLD_USE_NATIVE_POLYT1_UNPACK)
+  if (polyt1_unpack_native(r->coeffs, a) == MLD_NATIVE_FUNC_SUCCESS)
+  {
+    return;
+  }
+#endif /* MLD_USE_NATIVE_POLYT1_UNPACK */
+
   for (i = 0; i < MLDSA_N / 4; ++i)
   __loop__(
     invariant(i <= MLDSA_N/4)
@@ -556,6 +761,13 @@ void polyt0_pack(uint8_t *r, const poly *a)
   unsigned int i;
   uint32_t t[8];
 
+#if defined(MLD_USE_NATIVE_POLYT0_PACK)
+  if (polyt0_pack_native(r, a->coeffs) == MLD_NATIVE_FUNC_SUCCESS)
+  {
+    return;
+  }
+#endif /* MLD_USE_NATIVE_POLYT0_PACK */
+
   for (i = 0; i < MLDSA_N / 8; ++i)
   __loop__(
     invariant(i <= MLDSA_N/8))
@@ -596,6 +808,13 @@ void polyt0_unpack(poly *r, const uint8_t *a)
 {
   unsigned int i;
 
+#if defined(MLD_USE_NATIVE_POLYT0_UNPACK)
+  if (polyt0_unpack_native(r->coeffs, a) == MLD_NATIVE_FUNC_SUCCESS)
+  {
+    return;
+  }
+#endif /* MLD_USE_NATIVE_POLYT0_UNPACK */
+
   for (i = 0; i < MLDSA_N / 8; ++i)
   __loop__(
     invariant(i <= MLDSA_N/8)
@@ -653,6 +872,13 @@ void polyz_pack(uint8_t *r, const poly *a)
   unsigned int i;
   uint32_t t[4];
 
+#if defined(MLD_USE_NATIVE_POLYZ_PACK)
+  if (polyz_pack_native(r, a->coeffs) == MLD_NATIVE_FUNC_SUCCESS)
+  {
+    return;
+  }
+#endif /* MLD_USE_NATIVE_POLYZ_PACK */
+
 #if MLDSA_MODE == 2
   for (i = 0; i < MLDSA_N / 4; ++i)
   __loop__(
@@ -698,6 +924,13 @@ void polyz_unpack(poly *r, const uint8_t *a)
 {
   unsigned int i;
 
+#if defined(MLD_USE_NATIVE_POLYZ_UNPACK)
+  if (polyz_unpack_native(r->coeffs, a) == MLD_NATIVE_FUNC_SUCCESS)
+  {
+    return;
+  }
+#endif /* MLD_USE_NATIVE_POLYZ_UNPACK */
+
 #if MLDSA_MODE == 2
   for (i = 0; i < MLDSA_N / 4; ++i)
   __loop__(
@@ -756,6 +989,13 @@ void polyw1_pack(uint8_t *r, const poly *a)
 {
   unsigned int i;
 
+#if defined(MLD_USE_NATIVE_POLYW1_PACK)
+  if (polyw1_pack_native(r, a->coeffs) == MLD_NATIVE_FUNC_SUCCESS)
+  {
+    return;
+  }
+#endif /* MLD_USE_NATIVE_POLYW1_PACK */
+
 #if MLDSA_MODE == 2
   for (i = 0; i < MLDSA_N / 4; ++i)
   __loop__(
@@ -293,6 +293,25 @@ __contract__(
  **************************************************/
 void poly_uniform(poly *a, const uint8_t seed[MLDSA_SEEDBYTES], uint16_t nonce);
 
+#define poly_uniform_4x MLD_NAMESPACE(poly_uniform_4x)
+/*************************************************
+ * Name:        poly_uniform_4x
+ *
+ * Description: Generate four polynomials using rejection sampling
+ *              on (pseudo-)uniformly random bytes sampled from a seed.
+ *              This is equivalent to four calls to poly_uniform, but
+ *              runs the four SHAKE128 instances in parallel.
+ *
+ * Arguments:   - poly *vec0, ..., *vec3: pointers to output polynomials
+ *              - const uint8_t seed[]: byte array with seed of length
+ *                MLDSA_SEEDBYTES
+ *              - uint16_t nonce0, ..., nonce3: 2-byte nonces, one per
+ *                output polynomial
+ **************************************************/
+void poly_uniform_4x(poly *vec0, poly *vec1, poly *vec2, poly *vec3,
+                     const uint8_t seed[MLDSA_SEEDBYTES], uint16_t nonce0,
+                     uint16_t nonce1, uint16_t nonce2, uint16_t nonce3);
+
 #define poly_uniform_eta MLD_NAMESPACE(poly_uniform_eta)
 /*************************************************
  * Name:        poly_uniform_eta
@@ -325,6 +344,24 @@ void poly_uniform_eta(poly *a, const uint8_t seed[MLDSA_CRHBYTES],
 void poly_uniform_gamma1(poly *a, const uint8_t seed[MLDSA_CRHBYTES],
                          uint16_t nonce);
 
+#define poly_uniform_gamma1_4x MLD_NAMESPACE(poly_uniform_gamma1_4x)
+/*************************************************
+ * Name:        poly_uniform_gamma1_4x
+ *
+ * Description: Equivalent to four calls to poly_uniform_gamma1, but runs
+ *              the four SHAKE256 instances in parallel.
+ *
+ * Arguments:   - poly *a0, ..., *a3: pointers to output polynomials
+ *              - const uint8_t seed[]: byte array with seed of length
+ *                MLDSA_CRHBYTES
+ *              - uint16_t nonce0, ..., nonce3: 16-bit nonces, one per
+ *                output polynomial
+ **************************************************/
+void poly_uniform_gamma1_4x(poly *a0, poly *a1, poly *a2, poly *a3,
+                            const uint8_t seed[MLDSA_CRHBYTES],
+                            uint16_t nonce0, uint16_t nonce1, uint16_t nonce2,
+                            uint16_t nonce3);
+
 #define poly_challenge MLD_NAMESPACE(poly_challenge)
 /*************************************************
  * Name:        poly_challenge
@@ -339,6 +376,80 @@ void poly_uniform_gamma1(poly *a, const uint8_t seed[MLDSA_CRHBYTES],
  **************************************************/
 void poly_challenge(poly *c, const uint8_t seed[MLDSA_CTILDEBYTES]);
 
+#define poly_challenge_4x MLD_NAMESPACE(poly_challenge_4x)
+/*************************************************
+ * Name:        poly_challenge_4x
+ *
+ * Description: Equivalent to four calls to poly_challenge, but runs the
+ *              four SHAKE256 instances in parallel.
+ *
+ * Arguments:   - poly *c0, ..., *c3: pointers to output polynomials
+ *              - const uint8_t seed0[], ..., seed3[]: byte arrays containing
+ *                seeds of length MLDSA_CTILDEBYTES
+ **************************************************/
+void poly_challenge_4x(poly *c0, poly *c1, poly *c2, poly *c3,
+                       const uint8_t seed0[MLDSA_CTILDEBYTES],
+                       const uint8_t seed1[MLDSA_CTILDEBYTES],
+                       const uint8_t seed2[MLDSA_CTILDEBYTES],
+                       const uint8_t seed3[MLDSA_CTILDEBYTES]);
+
+/* Challenge polynomial in sparse form: the positions and signs of its
+ * MLDSA_TAU nonzero coefficients */
+typedef struct
+{
+  uint8_t pos[MLDSA_TAU];
+  int8_t sign[MLDSA_TAU];
+} poly_challenge_sparse;
+
+#define poly_challenge_to_sparse MLD_NAMESPACE(poly_challenge_to_sparse)
+/*************************************************
+ * Name:        poly_challenge_to_sparse
+ *
+ * Description: Converts a challenge polynomial as output by poly_challenge
+ *              to sparse form.
+ *
+ * Arguments:   - poly_challenge_sparse *s: pointer to output
+ *              - const poly *c: pointer to challenge polynomial with
+ *                exactly MLDSA_TAU coefficients in {-1,1} and all others 0
+ **************************************************/
+void poly_challenge_to_sparse(poly_challenge_sparse *s, const poly *c)
+__contract__(
+  requires(memory_no_alias(s, sizeof(poly_challenge_sparse)))
+  requires(memory_no_alias(c, sizeof(poly)))
+  requires(array_bound(c->coeffs, 0, MLDSA_N, -1, 2))
+  assigns(memory_slice(s, sizeof(poly_challenge_sparse)))
+);
+
+#define poly_sparse_mul MLD_NAMESPACE(poly_sparse_mul)
+/*************************************************
+ * Name:        poly_sparse_mul
+ *
+ * Description: Multiplies a polynomial by a challenge in sparse form, in
+ *              normal domain, by adding up MLDSA_TAU negacyclic shifts of
+ *              the input. No modular reduction is performed: for input
+ *              coefficients bounded by B in absolute value, the output
+ *              coefficients are the exact ones of c * a in Z[X]/(X^N + 1),
+ *              bounded by MLDSA_TAU * B.
+ *
+ *              This is faster than multiplication in NTT domain for the
+ *              short secret vectors, and it does not need their NTT.
+ *
+ * Arguments:   - poly *r: pointer to output polynomial
+ *              - const poly_challenge_sparse *c: pointer to challenge
+ *              - const poly *a: pointer to input polynomial with
+ *                coefficients in (-2^12, 2^12]
+ **************************************************/
+void poly_sparse_mul(poly *r, const poly_challenge_sparse *c, const poly *a)
+__contract__(
+  requires(memory_no_alias(r, sizeof(poly)))
+  requires(memory_no_alias(c, sizeof(poly_challenge_sparse)))
+  requires(memory_no_alias(a, sizeof(poly)))
+  requires(array_abs_bound(a->coeffs, 0, MLDSA_N, (1 << (MLDSA_D - 1)) + 1))
+  assigns(memory_slice(r, sizeof(poly)))
+  ensures(array_abs_bound(r->coeffs, 0, MLDSA_N,
+    MLDSA_TAU * ((1 << (MLDSA_D - 1)) + 1)))
+);
+
 #define polyeta_pack MLD_NAMESPACE(polyeta_pack)
 /*************************************************
  * Name:        polyeta_pack
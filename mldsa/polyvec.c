@@ -3,36 +3,80 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 #include <stdint.h>
+#include <string.h>
 
 #include "common.h"
 #include "poly.h"
 #include "polyvec.h"
 
-void polyvec_matrix_expand(polyvecl mat[MLDSA_K],
-                           const uint8_t rho[MLDSA_SEEDBYTES])
+/* Nonce of the matrix entry a_{i,j} */
+#define MAT_NONCE_IJ(i, j) (((i) << 8) + (j))
+
+#if !defined(MLD_CONFIG_REDUCE_RAM)
+/* Matrix entry and nonce of the i-th polynomial in row-major order */
+#define MAT_ENTRY(mat, i) (&(mat)->vec[(i) / MLDSA_L].vec[(i) % MLDSA_L])
+#define MAT_NONCE(i) MAT_NONCE_IJ((i) / MLDSA_L, (i) % MLDSA_L)
+
+void polyvec_matrix_expand(polymat *mat, const uint8_t rho[MLDSA_SEEDBYTES])
 {
-  unsigned int i, j;
+  unsigned int i;
 
-  for (i = 0; i < MLDSA_K; ++i)
+  /*
+   * Sample four matrix entries a time
+   */
+  for (i = 0; i < (MLDSA_K * MLDSA_L / 4) * 4; i += 4)
   {
-    for (j = 0; j < MLDSA_L; ++j)
-    {
-      poly_uniform(&mat[i].vec[j], rho, (i << 8) + j);
-    }
+    poly_uniform_4x(MAT_ENTRY(mat, i + 0), MAT_ENTRY(mat, i + 1),
+                    MAT_ENTRY(mat, i + 2), MAT_ENTRY(mat, i + 3), rho,
+                    MAT_NONCE(i + 0), MAT_NONCE(i + 1), MAT_NONCE(i + 2),
+                    MAT_NONCE(i + 3));
+  }
+
+  /* For MLDSA_K * MLDSA_L not divisible by 4 (ML-DSA-65), sample the
+   * remaining entries individually */
+  for (; i < MLDSA_K * MLDSA_L; i++)
+  {
+    poly_uniform(MAT_ENTRY(mat, i), rho, MAT_NONCE(i));
   }
 }
 
-void polyvec_matrix_pointwise_montgomery(polyveck *t,
-                                         const polyvecl mat[MLDSA_K],
+void polyvec_matrix_pointwise_montgomery(polyveck *t, const polymat *mat,
                                          const polyvecl *v)
 {
   unsigned int i;
 
   for (i = 0; i < MLDSA_K; ++i)
   {
-    polyvecl_pointwise_acc_montgomery(&t->vec[i], &mat[i], v);
+    polyvecl_pointwise_acc_montgomery(&t->vec[i], &mat->vec[i], v);
   }
 }
+#else  /* !MLD_CONFIG_REDUCE_RAM */
+void polyvec_matrix_expand(polymat *mat, const uint8_t rho[MLDSA_SEEDBYTES])
+{
+  memcpy(mat->rho, rho, MLDSA_SEEDBYTES);
+}
+
+void polyvec_matrix_pointwise_montgomery(polyveck *t, const polymat *mat,
+                                         const polyvecl *v)
+{
+  unsigned int i, j;
+  poly a, u;
+
+  /* Same accumulation order as polyvecl_pointwise_acc_montgomery, so that
+   * the result is identical to the one of the stored matrix */
+  for (i = 0; i < MLDSA_K; ++i)
+  {
+    poly_uniform(&a, mat->rho, MAT_NONCE_IJ(i, 0));
+    poly_pointwise_montgomery(&t->vec[i], &a, &v->vec[0]);
+    for (j = 1; j < MLDSA_L; ++j)
+    {
+      poly_uniform(&a, mat->rho, MAT_NONCE_IJ(i, j));
+      poly_pointwise_montgomery(&u, &a, &v->vec[j]);
+      poly_add(&t->vec[i], &t->vec[i], &u);
+    }
+  }
+}
+#endif /* MLD_CONFIG_REDUCE_RAM */
 
 /**************************************************************/
 /************ Vectors of polynomials of length MLDSA_L **************/
@@ -60,6 +104,22 @@ void polyvecl_uniform_gamma1(polyvecl *v, const uint8_t seed[MLDSA_CRHBYTES],
   }
 }
 
+void polyvecl_uniform_gamma1_4x(polyvecl *v0, polyvecl *v1, polyvecl *v2,
+                                polyvecl *v3,
+                                const uint8_t seed[MLDSA_CRHBYTES],
+                                uint16_t nonce)
+{
+  unsigned int i;
+
+  for (i = 0; i < MLDSA_L; ++i)
+  {
+    poly_uniform_gamma1_4x(&v0->vec[i], &v1->vec[i], &v2->vec[i], &v3->vec[i],
+                           seed, MLDSA_L * (nonce + 0) + i,
+                           MLDSA_L * (nonce + 1) + i, MLDSA_L * (nonce + 2) + i,
+                           MLDSA_L * (nonce + 3) + i);
+  }
+}
+
 void polyvecl_reduce(polyvecl *v)
 {
   unsigned int i;
@@ -24,6 +24,19 @@ void polyvecl_uniform_eta(polyvecl *v, const uint8_t seed[MLDSA_CRHBYTES],
 void polyvecl_uniform_gamma1(polyvecl *v, const uint8_t seed[MLDSA_CRHBYTES],
                              uint16_t nonce);
 
+#define polyvecl_uniform_gamma1_4x MLD_NAMESPACE(polyvecl_uniform_gamma1_4x)
+/*************************************************
+ * Name:        polyvecl_uniform_gamma1_4x
+ *
+ * Description: Equivalent to calling polyvecl_uniform_gamma1 for v0, ...,
+ *              v3 with the consecutive nonces nonce, ..., nonce + 3, but
+ *              runs four SHAKE256 instances in parallel.
+ **************************************************/
+void polyvecl_uniform_gamma1_4x(polyvecl *v0, polyvecl *v1, polyvecl *v2,
+                                polyvecl *v3,
+                                const uint8_t seed[MLDSA_CRHBYTES],
+                                uint16_t nonce);
+
 #define polyvecl_reduce MLD_NAMESPACE(polyvecl_reduce)
 /*************************************************
  * Name:        polyvecl_reduce
@@ -458,6 +471,21 @@ __contract__(
     array_bound(p->vec[k1].coeffs, 0, MLDSA_N, -(1<<(MLDSA_D-1)) + 1, (1<<(MLDSA_D-1)) + 1)))
 );
 
+/*
+ * The K x L matrix A in NTT domain.
+ *
+ * With MLD_CONFIG_REDUCE_RAM, only the seed rho is kept and the entries
+ * of A are sampled on demand by polyvec_matrix_pointwise_montgomery.
+ */
+typedef struct
+{
+#if !defined(MLD_CONFIG_REDUCE_RAM)
+  polyvecl vec[MLDSA_K];
+#else  /* !MLD_CONFIG_REDUCE_RAM */
+  uint8_t rho[MLDSA_SEEDBYTES];
+#endif /* MLD_CONFIG_REDUCE_RAM */
+} polymat;
+
 #define polyvec_matrix_expand MLD_NAMESPACE(polyvec_matrix_expand)
 /*************************************************
  * Name:        polyvec_matrix_expand
@@ -466,16 +494,30 @@ __contract__(
  *              random coefficients a_{i,j} by performing rejection
  *              sampling on the output stream of SHAKE128(rho|j|i)
  *
- * Arguments:   - polyvecl mat[MLDSA_K]: output matrix
+ *              With MLD_CONFIG_REDUCE_RAM, this only records rho.
+ *
+ * Arguments:   - polymat *mat: output matrix
  *              - const uint8_t rho[]: byte array containing seed rho
  **************************************************/
-void polyvec_matrix_expand(polyvecl mat[MLDSA_K],
-                           const uint8_t rho[MLDSA_SEEDBYTES]);
+void polyvec_matrix_expand(polymat *mat, const uint8_t rho[MLDSA_SEEDBYTES]);
 
 #define polyvec_matrix_pointwise_montgomery \
   MLD_NAMESPACE(polyvec_matrix_pointwise_montgomery)
-void polyvec_matrix_pointwise_montgomery(polyveck *t,
-                                         const polyvecl mat[MLDSA_K],
+/*************************************************
+ * Name:        polyvec_matrix_pointwise_montgomery
+ *
+ * Description: Computes t = A * v in NTT domain, with Montgomery
+ *              multiplication and without final reduction.
+ *
+ *              With MLD_CONFIG_REDUCE_RAM, every entry a_{i,j} is sampled
+ *              right before it is multiplied into t_i, so that only one
+ *              entry of A is held in memory at a time.
+ *
+ * Arguments:   - polyveck *t: output vector
+ *              - const polymat *mat: input matrix
+ *              - const polyvecl *v: input vector in NTT domain
+ **************************************************/
+void polyvec_matrix_pointwise_montgomery(polyveck *t, const polymat *mat,
                                          const polyvecl *v);
 
 #endif /* !MLD_POLYVEC_H */
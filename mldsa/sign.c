@@ -14,15 +14,78 @@
 #include "sign.h"
 #include "symmetric.h"
 
-int crypto_sign_keypair_internal(uint8_t *pk, uint8_t *sk,
-                                 const uint8_t seed[MLDSA_SEEDBYTES])
+/* Included after config.h, which sets MLD_CONFIG_SIGN_THREADS */
+#if defined(MLD_CONFIG_SIGN_THREADS) && MLD_CONFIG_SIGN_THREADS > 1
+#include <limits.h>
+#include <pthread.h>
+#endif /* MLD_CONFIG_SIGN_THREADS > 1 */
+
+#if defined(MLD_CONFIG_SIGN_STATS)
+#if !defined(MLD_THREAD_LOCAL)
+#error MLD_CONFIG_SIGN_STATS requires thread-local storage
+#endif /* !MLD_THREAD_LOCAL */
+
+/* Statistics of the calling thread, and its number of attempts at the
+ * start of its current signing operation */
+static MLD_THREAD_LOCAL mld_sign_stats mld_stats;
+static MLD_THREAD_LOCAL uint64_t mld_stats_call_start;
+
+#define MLD_SIGN_STATS_ATTEMPT() (mld_stats.attempts++)
+#define MLD_SIGN_STATS_REJECT(check) (mld_stats.reject_##check++)
+
+static void mld_sign_stats_begin(void)
+{
+  mld_stats_call_start = mld_stats.attempts;
+}
+
+static void mld_sign_stats_end(void)
+{
+  uint64_t n = mld_stats.attempts - mld_stats_call_start;
+
+  mld_stats.calls++;
+  mld_stats.last_attempts = n;
+  mld_stats.hist[n < MLD_SIGN_STATS_HISTBINS ? n - 1
+                                             : MLD_SIGN_STATS_HISTBINS - 1]++;
+}
+
+void crypto_sign_stats(mld_sign_stats *stats) { *stats = mld_stats; }
+
+void crypto_sign_stats_reset(void)
+{
+  memset(&mld_stats, 0, sizeof(mld_stats));
+}
+#else  /* MLD_CONFIG_SIGN_STATS */
+#define MLD_SIGN_STATS_ATTEMPT() \
+  do                             \
+  {                              \
+  } while (0)
+#define MLD_SIGN_STATS_REJECT(check) \
+  do                                 \
+  {                                  \
+  } while (0)
+#define mld_sign_stats_begin() \
+  do                           \
+  {                            \
+  } while (0)
+#define mld_sign_stats_end() \
+  do                         \
+  {                          \
+  } while (0)
+#endif /* !MLD_CONFIG_SIGN_STATS */
+
+/*************************************************
+ * Name:        mld_keypair_ws
+ *
+ * Description: Key generation with the large temporaries kept in
+ *              caller-provided scratch space.
+ **************************************************/
+static int mld_keypair_ws(uint8_t *pk, uint8_t *sk,
+                          const uint8_t seed[MLDSA_SEEDBYTES],
+                          mld_keypair_scratch *ws)
 {
   uint8_t seedbuf[2 * MLDSA_SEEDBYTES + MLDSA_CRHBYTES];
   uint8_t tr[MLDSA_TRBYTES];
   const uint8_t *rho, *rhoprime, *key;
-  polyvecl mat[MLDSA_K];
-  polyvecl s1, s1hat;
-  polyveck s2, t1, t0;
 
   /* Get randomness for rho, rhoprime and key */
   memcpy(seedbuf, seed, MLDSA_SEEDBYTES);
@@ -35,33 +98,40 @@ int crypto_sign_keypair_internal(uint8_t *pk, uint8_t *sk,
   key = rhoprime + MLDSA_CRHBYTES;
 
   /* Expand matrix */
-  polyvec_matrix_expand(mat, rho);
+  polyvec_matrix_expand(&ws->mat, rho);
 
   /* Sample short vectors s1 and s2 */
-  polyvecl_uniform_eta(&s1, rhoprime, 0);
-  polyveck_uniform_eta(&s2, rhoprime, MLDSA_L);
+  polyvecl_uniform_eta(&ws->s1, rhoprime, 0);
+  polyveck_uniform_eta(&ws->s2, rhoprime, MLDSA_L);
 
   /* Matrix-vector multiplication */
-  s1hat = s1;
-  polyvecl_ntt(&s1hat);
-  polyvec_matrix_pointwise_montgomery(&t1, mat, &s1hat);
-  polyveck_reduce(&t1);
-  polyveck_invntt_tomont(&t1);
+  ws->s1hat = ws->s1;
+  polyvecl_ntt(&ws->s1hat);
+  polyvec_matrix_pointwise_montgomery(&ws->t1, &ws->mat, &ws->s1hat);
+  polyveck_reduce(&ws->t1);
+  polyveck_invntt_tomont(&ws->t1);
 
   /* Add error vector s2 */
-  polyveck_add(&t1, &t1, &s2);
+  polyveck_add(&ws->t1, &ws->t1, &ws->s2);
 
   /* Extract t1 and write public key */
-  polyveck_caddq(&t1);
-  polyveck_power2round(&t1, &t0, &t1);
-  pack_pk(pk, rho, &t1);
+  polyveck_caddq(&ws->t1);
+  polyveck_power2round(&ws->t1, &ws->t0, &ws->t1);
+  pack_pk(pk, rho, &ws->t1);
 
   /* Compute H(rho, t1) and write secret key */
   shake256(tr, MLDSA_TRBYTES, pk, CRYPTO_PUBLICKEYBYTES);
-  pack_sk(sk, rho, tr, key, &t0, &s1, &s2);
+  pack_sk(sk, rho, tr, key, &ws->t0, &ws->s1, &ws->s2);
   return 0;
 }
 
+int crypto_sign_keypair_internal(uint8_t *pk, uint8_t *sk,
+                                 const uint8_t seed[MLDSA_SEEDBYTES])
+{
+  mld_keypair_scratch ws;
+  return mld_keypair_ws(pk, sk, seed, &ws);
+}
+
 int crypto_sign_keypair(uint8_t *pk, uint8_t *sk)
 {
   uint8_t seed[MLDSA_SEEDBYTES];
@@ -69,33 +139,96 @@ int crypto_sign_keypair(uint8_t *pk, uint8_t *sk)
   return crypto_sign_keypair_internal(pk, sk, seed);
 }
 
+/* The size of mld_workspace is bounded by the public API, see api.h */
+typedef char mld_workspace_size_check
+    [(sizeof(mld_workspace) <= CRYPTO_WORKSPACEBYTES) ? 1 : -1];
+
+int crypto_sign_keypair_ws(uint8_t *pk, uint8_t *sk, mld_workspace *ws)
+{
+  uint8_t seed[MLDSA_SEEDBYTES];
+  randombytes(seed, MLDSA_SEEDBYTES);
+  return mld_keypair_ws(pk, sk, seed, &ws->u.keypair);
+}
+
+/* The size of mld_expanded_sk is bounded by the public API, see api.h */
+typedef char mld_expanded_sk_size_check
+    [(sizeof(mld_expanded_sk) <= CRYPTO_EXPANDEDSKBYTES) ? 1 : -1];
+
+/*************************************************
+ * Name:        mld_native_intt_usable
+ *
+ * Description: Checks whether the inverse NTT runs natively on this CPU.
+ *              Native backends report missing CPU support by falling
+ *              back, so this is probed on a zero polynomial.
+ **************************************************/
+static int mld_native_intt_usable(void)
+{
+#if defined(MLD_USE_NATIVE_INTT)
+  poly probe;
+  memset(&probe, 0, sizeof(poly));
+  return intt_native(probe.coeffs) == MLD_NATIVE_FUNC_SUCCESS;
+#else  /* MLD_USE_NATIVE_INTT */
+  return 0;
+#endif /* !MLD_USE_NATIVE_INTT */
+}
+
+int crypto_sign_expand_sk(mld_expanded_sk *esk, const uint8_t *sk)
+{
+  uint8_t tr[MLDSA_TRBYTES];
+  uint8_t key[MLDSA_SEEDBYTES];
+
+  unpack_sk(esk->rho, tr, key, &esk->t0, &esk->s1, &esk->s2, sk);
+
+  /* Checkpoint the prefixes of mu = CRH(tr, ...) and
+   * rhoprime = CRH(key, ...) */
+  shake256_init(&esk->tr_state);
+  shake256_absorb(&esk->tr_state, tr, MLDSA_TRBYTES);
+  shake256_init(&esk->key_state);
+  shake256_absorb(&esk->key_state, key, MLDSA_SEEDBYTES);
+
+  /* Expand matrix and transform vectors */
+  polyvec_matrix_expand(&esk->mat, esk->rho);
+  esk->sparse_challenge = !mld_native_intt_usable();
+  if (!esk->sparse_challenge)
+  {
+    polyvecl_ntt(&esk->s1);
+    polyveck_ntt(&esk->s2);
+    polyveck_ntt(&esk->t0);
+  }
+  return 0;
+}
+
 int crypto_sign_signature_internal(uint8_t *sig, size_t *siglen,
                                    const uint8_t *m, size_t mlen,
                                    const uint8_t *pre, size_t prelen,
                                    const uint8_t rnd[MLDSA_RNDBYTES],
                                    const uint8_t *sk, int externalmu)
 {
-  unsigned int n;
-  uint8_t seedbuf[2 * MLDSA_SEEDBYTES + MLDSA_TRBYTES + 2 * MLDSA_CRHBYTES];
-  uint8_t *rho, *tr, *key, *mu, *rhoprime;
-  uint16_t nonce = 0;
-  polyvecl mat[MLDSA_K], s1, y, z;
-  polyveck t0, s2, w1, w0, h;
-  poly cp;
-  keccak_state state;
+  mld_expanded_sk esk;
 
-  rho = seedbuf;
-  tr = rho + MLDSA_SEEDBYTES;
-  key = tr + MLDSA_TRBYTES;
-  mu = key + MLDSA_SEEDBYTES;
-  rhoprime = mu + MLDSA_CRHBYTES;
-  unpack_sk(rho, tr, key, &t0, &s1, &s2, sk);
+  crypto_sign_expand_sk(&esk, sk);
+  return crypto_sign_signature_expanded_internal(sig, siglen, m, mlen, pre,
+                                                 prelen, rnd, &esk, externalmu);
+}
+
+/*************************************************
+ * Name:        mld_sign_seeds
+ *
+ * Description: Computes mu = CRH(tr, pre, msg), unless provided directly,
+ *              and rhoprime = CRH(key, rnd, mu).
+ **************************************************/
+static void mld_sign_seeds(uint8_t mu[MLDSA_CRHBYTES],
+                           uint8_t rhoprime[MLDSA_CRHBYTES], const uint8_t *m,
+                           size_t mlen, const uint8_t *pre, size_t prelen,
+                           const uint8_t rnd[MLDSA_RNDBYTES],
+                           const mld_expanded_sk *esk, int externalmu)
+{
+  keccak_state state;
 
   if (!externalmu)
   {
     /* Compute mu = CRH(tr, pre, msg) */
-    shake256_init(&state);
-    shake256_absorb(&state, tr, MLDSA_TRBYTES);
+    shake256_clone(&state, &esk->tr_state);
     shake256_absorb(&state, pre, prelen);
     shake256_absorb(&state, m, mlen);
     shake256_finalize(&state);
@@ -108,141 +241,682 @@ int crypto_sign_signature_internal(uint8_t *sig, size_t *siglen,
   }
 
   /* Compute rhoprime = CRH(key, rnd, mu) */
-  shake256_init(&state);
-  shake256_absorb(&state, key, MLDSA_SEEDBYTES);
+  shake256_clone(&state, &esk->key_state);
   shake256_absorb(&state, rnd, MLDSA_RNDBYTES);
   shake256_absorb(&state, mu, MLDSA_CRHBYTES);
   shake256_finalize(&state);
   shake256_squeeze(rhoprime, MLDSA_CRHBYTES, &state);
+}
 
-  /* Expand matrix and transform vectors */
-  polyvec_matrix_expand(mat, rho);
-  polyvecl_ntt(&s1);
-  polyveck_ntt(&s2);
-  polyveck_ntt(&t0);
+/*************************************************
+ * Name:        mld_sign_w1
+ *
+ * Description: First half of a signing attempt: computes w = Ay for the
+ *              intermediate vector ws->y, decomposes it into ws->w1 and
+ *              ws->w0 and packs w1. ws->z is set to NTT(y) in passing.
+ **************************************************/
+static void mld_sign_w1(uint8_t buf[MLDSA_K * MLDSA_POLYW1_PACKEDBYTES],
+                        const mld_expanded_sk *esk, mld_sign_scratch *ws)
+{
+  /* Matrix-vector multiplication */
+  ws->z = ws->y;
+  polyvecl_ntt(&ws->z);
+  polyvec_matrix_pointwise_montgomery(&ws->w1, &esk->mat, &ws->z);
+  polyveck_reduce(&ws->w1);
+  polyveck_invntt_tomont(&ws->w1);
 
-rej:
-  /* Sample intermediate vector y */
-  polyvecl_uniform_gamma1(&y, rhoprime, nonce++);
+  /* Decompose w */
+  polyveck_caddq(&ws->w1);
+  polyveck_decompose(&ws->w1, &ws->w0, &ws->w1);
+  polyveck_pack_w1(buf, &ws->w1);
+}
 
-  /* Matrix-vector multiplication */
-  z = y;
-  polyvecl_ntt(&z);
-  polyvec_matrix_pointwise_montgomery(&w1, mat, &z);
-  polyveck_reduce(&w1);
-  polyveck_invntt_tomont(&w1);
+/* Challenge polynomial, in NTT domain or in sparse form as selected by
+ * the sparse_challenge flag of the expanded secret key */
+typedef union
+{
+  poly ntt;
+  poly_challenge_sparse sparse;
+} mld_challenge;
 
-  /* Decompose w and call the random oracle */
-  polyveck_caddq(&w1);
-  polyveck_decompose(&w1, &w0, &w1);
-  polyveck_pack_w1(sig, &w1);
+/*************************************************
+ * Name:        mld_challenge_mul
+ *
+ * Description: Computes r = c * a in normal domain for a polynomial a of
+ *              the expanded secret key, bounded by 2^12 in absolute value.
+ **************************************************/
+static void mld_challenge_mul(poly *r, const mld_challenge *c, const poly *a,
+                              int sparse)
+{
+  if (sparse)
+  {
+    poly_sparse_mul(r, &c->sparse, a);
+  }
+  else
+  {
+    poly_pointwise_montgomery(r, &c->ntt, a);
+    poly_invntt_tomont(r);
+  }
+}
 
-  shake256_init(&state);
-  shake256_absorb(&state, mu, MLDSA_CRHBYTES);
-  shake256_absorb(&state, sig, MLDSA_K * MLDSA_POLYW1_PACKEDBYTES);
-  shake256_finalize(&state);
-  shake256_squeeze(sig, MLDSA_CTILDEBYTES, &state);
-  poly_challenge(&cp, sig);
-  poly_ntt(&cp);
+/*************************************************
+ * Name:        mld_sign_respond
+ *
+ * Description: Second half of a signing attempt: given the challenge
+ *              polynomial ws->cp sampled from ctilde, computes z and the
+ *              hint and runs the rejection checks.
+ *
+ *              z, w0 - cs2 and ct0 are computed one polynomial at a time,
+ *              and the attempt is aborted at the first polynomial failing
+ *              its norm check, skipping the remaining work. This does not
+ *              leak more than checking whole vectors: polyvec*_chknorm
+ *              also return at the first failing polynomial, and which
+ *              polynomial fails is independent of the secret key. Within
+ *              a polynomial, poly_chknorm runs in constant time.
+ *
+ * Returns 0 and writes the signature to sig if the attempt is accepted,
+ * and -1 if it is rejected. ctilde may alias sig.
+ **************************************************/
+static int mld_sign_respond(uint8_t sig[CRYPTO_BYTES],
+                            const uint8_t ctilde[MLDSA_CTILDEBYTES],
+                            const mld_expanded_sk *esk, mld_sign_scratch *ws)
+{
+  unsigned int i, n;
+  poly t;
+  mld_challenge c;
+  const int sparse = esk->sparse_challenge;
 
-  /* Compute z, reject if it reveals secret */
-  polyvecl_pointwise_poly_montgomery(&z, &cp, &s1);
-  polyvecl_invntt_tomont(&z);
-  polyvecl_add(&z, &z, &y);
-  polyvecl_reduce(&z);
-  if (polyvecl_chknorm(&z, MLDSA_GAMMA1 - MLDSA_BETA))
+  if (sparse)
+  {
+    poly_challenge_to_sparse(&c.sparse, &ws->cp);
+  }
+  else
   {
-    goto rej;
+    c.ntt = ws->cp;
+    poly_ntt(&c.ntt);
+  }
+
+  MLD_SIGN_STATS_ATTEMPT();
+
+  /* Compute z = y + cs1, reject if it reveals secret */
+  for (i = 0; i < MLDSA_L; ++i)
+  {
+    mld_challenge_mul(&t, &c, &esk->s1.vec[i], sparse);
+    poly_add(&ws->z.vec[i], &t, &ws->y.vec[i]);
+    poly_reduce(&ws->z.vec[i]);
+    if (poly_chknorm(&ws->z.vec[i], MLDSA_GAMMA1 - MLDSA_BETA))
+    {
+      MLD_SIGN_STATS_REJECT(z);
+      return -1;
+    }
   }
 
   /* Check that subtracting cs2 does not change high bits of w and low bits
    * do not reveal secret information */
-  polyveck_pointwise_poly_montgomery(&h, &cp, &s2);
-  polyveck_invntt_tomont(&h);
-  polyveck_sub(&w0, &w0, &h);
-  polyveck_reduce(&w0);
-  if (polyveck_chknorm(&w0, MLDSA_GAMMA2 - MLDSA_BETA))
+  for (i = 0; i < MLDSA_K; ++i)
   {
-    goto rej;
+    mld_challenge_mul(&ws->h.vec[i], &c, &esk->s2.vec[i], sparse);
+    poly_sub(&t, &ws->w0.vec[i], &ws->h.vec[i]);
+    poly_reduce(&t);
+    ws->w0.vec[i] = t;
+    if (poly_chknorm(&ws->w0.vec[i], MLDSA_GAMMA2 - MLDSA_BETA))
+    {
+      MLD_SIGN_STATS_REJECT(w0);
+      return -1;
+    }
   }
 
   /* Compute hints for w1 */
-  polyveck_pointwise_poly_montgomery(&h, &cp, &t0);
-  polyveck_invntt_tomont(&h);
-  polyveck_reduce(&h);
-  if (polyveck_chknorm(&h, MLDSA_GAMMA2))
+  for (i = 0; i < MLDSA_K; ++i)
   {
-    goto rej;
+    mld_challenge_mul(&ws->h.vec[i], &c, &esk->t0.vec[i], sparse);
+    poly_reduce(&ws->h.vec[i]);
+    if (poly_chknorm(&ws->h.vec[i], MLDSA_GAMMA2))
+    {
+      MLD_SIGN_STATS_REJECT(ct0);
+      return -1;
+    }
   }
 
-  polyveck_add(&w0, &w0, &h);
-  n = polyveck_make_hint(&h, &w0, &w1);
+  polyveck_add(&ws->w0, &ws->w0, &ws->h);
+  n = polyveck_make_hint(&ws->h, &ws->w0, &ws->w1);
   if (n > MLDSA_OMEGA)
   {
-    goto rej;
+    MLD_SIGN_STATS_REJECT(hints);
+    return -1;
   }
 
   /* Write signature */
-  pack_sig(sig, sig, &z, &h, n);
+  pack_sig(sig, ctilde, &ws->z, &ws->h, n);
+  return 0;
+}
+
+/*************************************************
+ * Name:        mld_sign_attempt
+ *
+ * Description: One iteration of the rejection loop of signing, using the
+ *              given nonce for sampling y. Attempts only depend on their
+ *              nonce, so they may be evaluated in any order.
+ *
+ * Returns 0 and writes the signature to sig if the attempt is accepted,
+ * and -1 if it is rejected. sig is clobbered in either case.
+ **************************************************/
+static int mld_sign_attempt(uint8_t sig[CRYPTO_BYTES],
+                            const uint8_t mu[MLDSA_CRHBYTES],
+                            const uint8_t rhoprime[MLDSA_CRHBYTES],
+                            uint16_t nonce, const mld_expanded_sk *esk,
+                            mld_sign_scratch *ws)
+{
+  keccak_state state;
+
+  /* Sample intermediate vector y and compute w1 */
+  polyvecl_uniform_gamma1(&ws->y, rhoprime, nonce);
+  mld_sign_w1(sig, esk, ws);
+
+  /* Call the random oracle */
+  shake256_init(&state);
+  shake256_absorb(&state, mu, MLDSA_CRHBYTES);
+  shake256_absorb(&state, sig, MLDSA_K * MLDSA_POLYW1_PACKEDBYTES);
+  shake256_finalize(&state);
+  shake256_squeeze(sig, MLDSA_CTILDEBYTES, &state);
+  poly_challenge(&ws->cp, sig);
+
+  return mld_sign_respond(sig, sig, esk, ws);
+}
+
+#if defined(MLD_CONFIG_SIGN_4X)
+/*************************************************
+ * Name:        mld_sign_attempt_4x
+ *
+ * Description: Speculatively evaluates the four attempts with nonces
+ *              nonce, ..., nonce + 3. Sampling y, computing w1 and calling
+ *              the random oracle are done for all four, using 4-way
+ *              SHAKE256; the rejection checks are then run in nonce order
+ *              until the first attempt is accepted.
+ *
+ * Returns the offset in [0,3] of the first accepted attempt, whose
+ * signature is written to sig, or -1 if all four are rejected.
+ **************************************************/
+static int mld_sign_attempt_4x(uint8_t sig[CRYPTO_BYTES],
+                               const uint8_t mu[MLDSA_CRHBYTES],
+                               const uint8_t rhoprime[MLDSA_CRHBYTES],
+                               uint16_t nonce, const mld_expanded_sk *esk,
+                               mld_sign_scratch ws[4])
+{
+  /* Random oracle input mu || w1 for each lane */
+  uint8_t buf[4][MLDSA_CRHBYTES + MLDSA_K * MLDSA_POLYW1_PACKEDBYTES];
+  uint8_t c[4][SHAKE256_RATE];
+  keccakx4_state statex4;
+  int l;
+
+  polyvecl_uniform_gamma1_4x(&ws[0].y, &ws[1].y, &ws[2].y, &ws[3].y,
+                             rhoprime, nonce);
+  for (l = 0; l < 4; l++)
+  {
+    memcpy(buf[l], mu, MLDSA_CRHBYTES);
+    mld_sign_w1(buf[l] + MLDSA_CRHBYTES, esk, &ws[l]);
+  }
+
+  shake256x4_absorb_once(&statex4, buf[0], buf[1], buf[2], buf[3],
+                         sizeof(buf[0]));
+  shake256x4_squeezeblocks(c[0], c[1], c[2], c[3], 1, &statex4);
+  poly_challenge_4x(&ws[0].cp, &ws[1].cp, &ws[2].cp, &ws[3].cp, c[0], c[1],
+                    c[2], c[3]);
+
+  for (l = 0; l < 4; l++)
+  {
+    if (mld_sign_respond(sig, c[l], esk, &ws[l]) == 0)
+    {
+      return l;
+    }
+  }
+  return -1;
+}
+
+/* Attempts are evaluated in groups of four */
+#define MLD_SIGN_GROUP 4
+#define mld_sign_group mld_sign_attempt_4x
+#else  /* MLD_CONFIG_SIGN_4X */
+#define MLD_SIGN_GROUP 1
+#define mld_sign_group mld_sign_attempt
+#endif /* !MLD_CONFIG_SIGN_4X */
+
+/*************************************************
+ * Name:        mld_sign_expanded_ws
+ *
+ * Description: Signing with an expanded secret key, with the large
+ *              temporaries of the rejection loop kept in caller-provided
+ *              scratch space.
+ **************************************************/
+static int mld_sign_expanded_ws(uint8_t *sig, size_t *siglen,
+                                const uint8_t *m, size_t mlen,
+                                const uint8_t *pre, size_t prelen,
+                                const uint8_t rnd[MLDSA_RNDBYTES],
+                                const mld_expanded_sk *esk, int externalmu,
+                                mld_sign_scratch *ws)
+{
+  uint8_t mu[MLDSA_CRHBYTES], rhoprime[MLDSA_CRHBYTES];
+  uint16_t nonce = 0;
+
+  mld_sign_seeds(mu, rhoprime, m, mlen, pre, prelen, rnd, esk, externalmu);
+  mld_sign_stats_begin();
+  while (mld_sign_attempt(sig, mu, rhoprime, nonce++, esk, ws) != 0)
+  {
+  }
+  mld_sign_stats_end();
+
   *siglen = CRYPTO_BYTES;
   return 0;
 }
 
-int crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m,
-                          size_t mlen, const uint8_t *ctx, size_t ctxlen,
-                          const uint8_t *sk)
+#if defined(MLD_CONFIG_SIGN_THREADS) && MLD_CONFIG_SIGN_THREADS > 1
+/* Work shared between the threads of a parallel signing operation */
+typedef struct
+{
+  pthread_mutex_t lock;
+  /* Next nonce to evaluate */
+  unsigned int next;
+  /* Lowest accepted nonce so far, or UINT_MAX */
+  unsigned int best;
+  uint8_t *sig;
+  const uint8_t *mu, *rhoprime;
+  const mld_expanded_sk *esk;
+#if defined(MLD_CONFIG_SIGN_STATS)
+  /* Attempts and rejections of the created threads */
+  uint64_t attempts, reject_z, reject_w0, reject_ct0, reject_hints;
+#endif /* MLD_CONFIG_SIGN_STATS */
+} mld_sign_pool;
+
+/*************************************************
+ * Name:        mld_sign_worker
+ *
+ * Description: Evaluates groups of MLD_SIGN_GROUP attempts for increasing
+ *              nonces until every nonce below the lowest accepted one has
+ *              been taken. The signature of the lowest accepted nonce is
+ *              written to pool->sig.
+ **************************************************/
+static void *mld_sign_worker(void *arg)
+{
+  mld_sign_pool *pool = (mld_sign_pool *)arg;
+  mld_sign_scratch ws[MLD_SIGN_GROUP];
+  uint8_t sig[CRYPTO_BYTES];
+  unsigned int nonce;
+  int done, k;
+
+  for (;;)
+  {
+    pthread_mutex_lock(&pool->lock);
+    nonce = pool->next;
+    pool->next += MLD_SIGN_GROUP;
+    done = nonce >= pool->best;
+    pthread_mutex_unlock(&pool->lock);
+    if (done)
+    {
+      return NULL;
+    }
+
+    k = mld_sign_group(sig, pool->mu, pool->rhoprime, (uint16_t)nonce,
+                       pool->esk, ws);
+    if (k >= 0)
+    {
+      nonce += (unsigned int)k;
+      pthread_mutex_lock(&pool->lock);
+      if (nonce < pool->best)
+      {
+        pool->best = nonce;
+        memcpy(pool->sig, sig, CRYPTO_BYTES);
+      }
+      pthread_mutex_unlock(&pool->lock);
+    }
+  }
+}
+
+#if defined(MLD_CONFIG_SIGN_STATS)
+/*************************************************
+ * Name:        mld_sign_thread
+ *
+ * Description: Entry point of the threads created for a signing operation.
+ *              Their statistics start at zero and are handed to the
+ *              calling thread through the pool.
+ **************************************************/
+static void *mld_sign_thread(void *arg)
+{
+  mld_sign_pool *pool = (mld_sign_pool *)arg;
+
+  mld_sign_worker(pool);
+  pthread_mutex_lock(&pool->lock);
+  pool->attempts += mld_stats.attempts;
+  pool->reject_z += mld_stats.reject_z;
+  pool->reject_w0 += mld_stats.reject_w0;
+  pool->reject_ct0 += mld_stats.reject_ct0;
+  pool->reject_hints += mld_stats.reject_hints;
+  pthread_mutex_unlock(&pool->lock);
+  return NULL;
+}
+#else  /* MLD_CONFIG_SIGN_STATS */
+#define mld_sign_thread mld_sign_worker
+#endif /* !MLD_CONFIG_SIGN_STATS */
+
+/*************************************************
+ * Name:        mld_sign_expanded_parallel
+ *
+ * Description: Signing with an expanded secret key, evaluating the
+ *              attempts of the rejection loop on MLD_CONFIG_SIGN_THREADS
+ *              threads. The accepted attempt with the lowest nonce is
+ *              returned, so the signature is identical to the one of
+ *              mld_sign_expanded_ws.
+ **************************************************/
+static int mld_sign_expanded_parallel(uint8_t *sig, size_t *siglen,
+                                      const uint8_t *m, size_t mlen,
+                                      const uint8_t *pre, size_t prelen,
+                                      const uint8_t rnd[MLDSA_RNDBYTES],
+                                      const mld_expanded_sk *esk,
+                                      int externalmu)
+{
+  uint8_t mu[MLDSA_CRHBYTES], rhoprime[MLDSA_CRHBYTES];
+  pthread_t threads[MLD_CONFIG_SIGN_THREADS - 1];
+  int started[MLD_CONFIG_SIGN_THREADS - 1];
+  mld_sign_pool pool;
+  unsigned int t;
+
+  mld_sign_seeds(mu, rhoprime, m, mlen, pre, prelen, rnd, esk, externalmu);
+
+  if (pthread_mutex_init(&pool.lock, NULL) != 0)
+  {
+    return -1;
+  }
+  pool.next = 0;
+  pool.best = UINT_MAX;
+  pool.sig = sig;
+  pool.mu = mu;
+  pool.rhoprime = rhoprime;
+  pool.esk = esk;
+#if defined(MLD_CONFIG_SIGN_STATS)
+  pool.attempts = 0;
+  pool.reject_z = pool.reject_w0 = pool.reject_ct0 = pool.reject_hints = 0;
+#endif /* MLD_CONFIG_SIGN_STATS */
+  mld_sign_stats_begin();
+
+  /* The calling thread takes part; if a thread cannot be created, the
+   * remaining ones do its share of the work */
+  for (t = 0; t < MLD_CONFIG_SIGN_THREADS - 1; t++)
+  {
+    started[t] = pthread_create(&threads[t], NULL, mld_sign_thread, &pool) == 0;
+  }
+  mld_sign_worker(&pool);
+  for (t = 0; t < MLD_CONFIG_SIGN_THREADS - 1; t++)
+  {
+    if (started[t])
+    {
+      pthread_join(threads[t], NULL);
+    }
+  }
+
+#if defined(MLD_CONFIG_SIGN_STATS)
+  mld_stats.attempts += pool.attempts;
+  mld_stats.reject_z += pool.reject_z;
+  mld_stats.reject_w0 += pool.reject_w0;
+  mld_stats.reject_ct0 += pool.reject_ct0;
+  mld_stats.reject_hints += pool.reject_hints;
+#endif /* MLD_CONFIG_SIGN_STATS */
+  mld_sign_stats_end();
+
+  pthread_mutex_destroy(&pool.lock);
+  *siglen = CRYPTO_BYTES;
+  return 0;
+}
+#elif defined(MLD_CONFIG_SIGN_4X)
+/*************************************************
+ * Name:        mld_sign_expanded_4x
+ *
+ * Description: Signing with an expanded secret key, evaluating the
+ *              attempts of the rejection loop in groups of four. The first
+ *              accepted attempt in nonce order is returned, so the
+ *              signature is identical to the one of mld_sign_expanded_ws.
+ **************************************************/
+static int mld_sign_expanded_4x(uint8_t *sig, size_t *siglen,
+                                const uint8_t *m, size_t mlen,
+                                const uint8_t *pre, size_t prelen,
+                                const uint8_t rnd[MLDSA_RNDBYTES],
+                                const mld_expanded_sk *esk, int externalmu)
+{
+  uint8_t mu[MLDSA_CRHBYTES], rhoprime[MLDSA_CRHBYTES];
+  /* Up to 156 KiB of stack, see MLD_CONFIG_SIGN_4X in config.h */
+  mld_sign_scratch ws[4];
+  uint16_t nonce = 0;
+
+  mld_sign_seeds(mu, rhoprime, m, mlen, pre, prelen, rnd, esk, externalmu);
+  mld_sign_stats_begin();
+  while (mld_sign_attempt_4x(sig, mu, rhoprime, nonce, esk, ws) < 0)
+  {
+    nonce += 4;
+  }
+  mld_sign_stats_end();
+
+  *siglen = CRYPTO_BYTES;
+  return 0;
+}
+#endif /* MLD_CONFIG_SIGN_THREADS > 1 || MLD_CONFIG_SIGN_4X */
+
+/*************************************************
+ * Name:        mld_sign_result
+ *
+ * Description: Passes on the result of a signing operation. On failure,
+ *              clears the signature and sets its length to 0, so that no
+ *              partial signature is left for callers to pick up.
+ **************************************************/
+static int mld_sign_result(int ret, uint8_t *sig, size_t *siglen)
+{
+  if (ret != 0)
+  {
+    memset(sig, 0, CRYPTO_BYTES);
+    *siglen = 0;
+  }
+  return ret;
+}
+
+int crypto_sign_signature_expanded_internal(
+    uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen,
+    const uint8_t *pre, size_t prelen, const uint8_t rnd[MLDSA_RNDBYTES],
+    const mld_expanded_sk *esk, int externalmu)
+{
+  int ret;
+#if defined(MLD_CONFIG_SIGN_THREADS) && MLD_CONFIG_SIGN_THREADS > 1
+  ret = mld_sign_expanded_parallel(sig, siglen, m, mlen, pre, prelen, rnd, esk,
+                                   externalmu);
+#elif defined(MLD_CONFIG_SIGN_4X)
+  ret = mld_sign_expanded_4x(sig, siglen, m, mlen, pre, prelen, rnd, esk,
+                             externalmu);
+#else  /* MLD_CONFIG_SIGN_THREADS > 1 || MLD_CONFIG_SIGN_4X */
+  mld_sign_scratch ws;
+  ret = mld_sign_expanded_ws(sig, siglen, m, mlen, pre, prelen, rnd, esk,
+                             externalmu, &ws);
+#endif /* !(MLD_CONFIG_SIGN_THREADS > 1) && !MLD_CONFIG_SIGN_4X */
+  return mld_sign_result(ret, sig, siglen);
+}
+
+/* Maximum length of pre = (0, ctxlen, ctx) */
+#define MLD_PRE_MAXBYTES (2 + 255)
+
+/*************************************************
+ * Name:        mld_prepare_pre
+ *
+ * Description: Prepares the prefix pre = (0, ctxlen, ctx) of the message
+ *              in pure ML-DSA signing and verification, of length
+ *              2 + ctxlen.
+ *
+ * Returns 0, or -1 if the context string is longer than 255 bytes.
+ **************************************************/
+static int mld_prepare_pre(uint8_t pre[MLD_PRE_MAXBYTES], const uint8_t *ctx,
+                           size_t ctxlen)
 {
   size_t i;
-  uint8_t pre[257];
-  uint8_t rnd[MLDSA_RNDBYTES];
 
   if (ctxlen > 255)
   {
     return -1;
   }
 
-  /* Prepare pre = (0, ctxlen, ctx) */
   pre[0] = 0;
-  pre[1] = ctxlen;
+  pre[1] = (uint8_t)ctxlen;
   for (i = 0; i < ctxlen; i++)
   {
     pre[2 + i] = ctx[i];
   }
+  return 0;
+}
 
+/*************************************************
+ * Name:        mld_sign_rnd
+ *
+ * Description: Draws the signing randomness rnd, or sets it to zero for
+ *              deterministic signing.
+ **************************************************/
+static void mld_sign_rnd(uint8_t rnd[MLDSA_RNDBYTES])
+{
 #ifdef MLD_RANDOMIZED_SIGNING
   randombytes(rnd, MLDSA_RNDBYTES);
 #else
-  for (i = 0; i < MLDSA_RNDBYTES; i++)
-  {
-    rnd[i] = 0;
-  }
+  memset(rnd, 0, MLDSA_RNDBYTES);
 #endif /* !MLD_RANDOMIZED_SIGNING */
+}
 
-  crypto_sign_signature_internal(sig, siglen, m, mlen, pre, 2 + ctxlen, rnd, sk,
-                                 0);
+/*************************************************
+ * Name:        mld_sign_prepare
+ *
+ * Description: Prepares the prefix pre = (0, ctxlen, ctx) and the
+ *              randomness rnd of a signing operation.
+ *
+ * Returns 0, or -1 if the context string is longer than 255 bytes.
+ **************************************************/
+static int mld_sign_prepare(uint8_t pre[MLD_PRE_MAXBYTES],
+                            uint8_t rnd[MLDSA_RNDBYTES], const uint8_t *ctx,
+                            size_t ctxlen)
+{
+  if (mld_prepare_pre(pre, ctx, ctxlen))
+  {
+    return -1;
+  }
+  mld_sign_rnd(rnd);
   return 0;
 }
 
+int crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m,
+                          size_t mlen, const uint8_t *ctx, size_t ctxlen,
+                          const uint8_t *sk)
+{
+  uint8_t pre[MLD_PRE_MAXBYTES];
+  uint8_t rnd[MLDSA_RNDBYTES];
+
+  if (mld_sign_prepare(pre, rnd, ctx, ctxlen))
+  {
+    return -1;
+  }
+
+  return crypto_sign_signature_internal(sig, siglen, m, mlen, pre, 2 + ctxlen,
+                                        rnd, sk, 0);
+}
+
+int crypto_sign_signature_expanded(uint8_t *sig, size_t *siglen,
+                                   const uint8_t *m, size_t mlen,
+                                   const uint8_t *ctx, size_t ctxlen,
+                                   const mld_expanded_sk *esk)
+{
+  uint8_t pre[MLD_PRE_MAXBYTES];
+  uint8_t rnd[MLDSA_RNDBYTES];
+
+  if (mld_sign_prepare(pre, rnd, ctx, ctxlen))
+  {
+    return -1;
+  }
+
+  return crypto_sign_signature_expanded_internal(sig, siglen, m, mlen, pre,
+                                                 2 + ctxlen, rnd, esk, 0);
+}
+
+int crypto_sign_signature_ws(uint8_t *sig, size_t *siglen, const uint8_t *m,
+                             size_t mlen, const uint8_t *ctx, size_t ctxlen,
+                             const uint8_t *sk, mld_workspace *ws)
+{
+  int ret;
+  uint8_t pre[MLD_PRE_MAXBYTES];
+  uint8_t rnd[MLDSA_RNDBYTES];
+
+  if (mld_sign_prepare(pre, rnd, ctx, ctxlen))
+  {
+    return -1;
+  }
+
+  crypto_sign_expand_sk(&ws->u.sign.esk, sk);
+  ret = mld_sign_expanded_ws(sig, siglen, m, mlen, pre, 2 + ctxlen, rnd,
+                             &ws->u.sign.esk, 0, &ws->u.sign.scratch);
+  return mld_sign_result(ret, sig, siglen);
+}
+
 int crypto_sign_signature_extmu(uint8_t *sig, size_t *siglen,
                                 const uint8_t mu[MLDSA_CRHBYTES],
                                 const uint8_t *sk)
 {
   uint8_t rnd[MLDSA_RNDBYTES];
 
-#ifdef MLD_RANDOMIZED_SIGNING
-  randombytes(rnd, MLDSA_RNDBYTES);
-#else
-  size_t i;
-  for (i = 0; i < MLDSA_RNDBYTES; i++)
+  mld_sign_rnd(rnd);
+  return crypto_sign_signature_internal(sig, siglen, mu, 0, NULL, 0, rnd, sk,
+                                        1);
+}
+
+/*
+ * mld_sign_ctx is allocated by users of the public API, see api.h. The size
+ * of keccak_state depends on the platform, so CRYPTO_SIGNCTXBYTES is an
+ * upper bound.
+ */
+typedef char mld_sign_ctx_size_check
+    [(sizeof(mld_sign_ctx) <= CRYPTO_SIGNCTXBYTES) ? 1 : -1];
+
+int crypto_sign_init(mld_sign_ctx *sctx, const uint8_t *sk,
+                     const uint8_t *ctx, size_t ctxlen)
+{
+  uint8_t pre[2];
+
+  if (ctxlen > 255)
   {
-    rnd[i] = 0;
+    return -1;
   }
-#endif /* !MLD_RANDOMIZED_SIGNING */
 
-  crypto_sign_signature_internal(sig, siglen, mu, 0, NULL, 0, rnd, sk, 1);
+  pre[0] = 0;
+  pre[1] = ctxlen;
+
+  /* Start computing CRH(tr, pre, msg); tr is part of the secret key */
+  memcpy(sctx->sk, sk, CRYPTO_SECRETKEYBYTES);
+  shake256_init(&sctx->state);
+  shake256_absorb(&sctx->state, sk + 2 * MLDSA_SEEDBYTES, MLDSA_TRBYTES);
+  shake256_absorb(&sctx->state, pre, 2);
+  shake256_absorb(&sctx->state, ctx, ctxlen);
   return 0;
 }
 
+int crypto_sign_update(mld_sign_ctx *sctx, const uint8_t *m, size_t mlen)
+{
+  shake256_absorb(&sctx->state, m, mlen);
+  return 0;
+}
+
+int crypto_sign_final(mld_sign_ctx *sctx, uint8_t *sig, size_t *siglen)
+{
+  uint8_t mu[MLDSA_CRHBYTES];
+  int ret;
+
+  shake256_finalize(&sctx->state);
+  shake256_squeeze(mu, MLDSA_CRHBYTES, &sctx->state);
+  ret = crypto_sign_signature_extmu(sig, siglen, mu, sctx->sk);
+
+  /* Clear the state, which holds a copy of the secret key, and mu, which
+   * depends on the message. The 2-byte prefix absorbed by crypto_sign_init
+   * only holds the public context length, so it needs no clearing. */
+  mld_zeroize(sctx, sizeof(mld_sign_ctx));
+  mld_zeroize(mu, sizeof(mu));
+  return ret;
+}
+
 int crypto_sign(uint8_t *sm, size_t *smlen, const uint8_t *m, size_t mlen,
                 const uint8_t *ctx, size_t ctxlen, const uint8_t *sk)
 {
@@ -255,24 +929,130 @@ int crypto_sign(uint8_t *sm, size_t *smlen, const uint8_t *m, size_t mlen,
   }
   ret = crypto_sign_signature(sm, smlen, sm + CRYPTO_BYTES, mlen, ctx, ctxlen,
                               sk);
-  *smlen += mlen;
+  if (ret == 0)
+  {
+    *smlen += mlen;
+  }
   return ret;
 }
 
+/* The size of mld_expanded_pk is bounded by the public API, see api.h */
+typedef char mld_expanded_pk_size_check
+    [(sizeof(mld_expanded_pk) <= CRYPTO_EXPANDEDPKBYTES) ? 1 : -1];
+
+/*************************************************
+ * Name:        mld_expand_pk_polys
+ *
+ * Description: Expands the matrix A and computes NTT(t1 * 2^d), leaving
+ *              epk->tr_state unset. Sufficient for verification with
+ *              external mu, which does not need tr.
+ **************************************************/
+static void mld_expand_pk_polys(mld_expanded_pk *epk, const uint8_t *pk)
+{
+  uint8_t rho[MLDSA_SEEDBYTES];
+
+  unpack_pk(rho, &epk->t1hat, pk);
+  polyvec_matrix_expand(&epk->mat, rho);
+  polyveck_shiftl(&epk->t1hat);
+  polyveck_ntt(&epk->t1hat);
+}
+
+int crypto_sign_expand_pk(mld_expanded_pk *epk, const uint8_t *pk)
+{
+  uint8_t tr[MLDSA_TRBYTES];
+
+  /* Compute tr = H(pk) and checkpoint the prefix of mu = CRH(tr, ...) */
+  shake256(tr, MLDSA_TRBYTES, pk, CRYPTO_PUBLICKEYBYTES);
+  shake256_init(&epk->tr_state);
+  shake256_absorb(&epk->tr_state, tr, MLDSA_TRBYTES);
+
+  mld_expand_pk_polys(epk, pk);
+  return 0;
+}
+
 int crypto_sign_verify_internal(const uint8_t *sig, size_t siglen,
                                 const uint8_t *m, size_t mlen,
                                 const uint8_t *pre, size_t prelen,
                                 const uint8_t *pk, int externalmu)
+{
+  mld_expanded_pk epk;
+
+  if (siglen != CRYPTO_BYTES)
+  {
+    return -1;
+  }
+
+  crypto_sign_expand_pk(&epk, pk);
+  return crypto_sign_verify_expanded_internal(sig, siglen, m, mlen, pre,
+                                              prelen, &epk, externalmu);
+}
+
+/*************************************************
+ * Name:        mld_verify_mu
+ *
+ * Description: Computes mu = CRH(tr, pre, msg) for verification, starting
+ *              from the state after absorbing tr.
+ **************************************************/
+static void mld_verify_mu(uint8_t mu[MLDSA_CRHBYTES],
+                          const keccak_state *tr_state, const uint8_t *pre,
+                          size_t prelen, const uint8_t *m, size_t mlen)
+{
+  keccak_state state;
+
+  shake256_clone(&state, tr_state);
+  shake256_absorb(&state, pre, prelen);
+  shake256_absorb(&state, m, mlen);
+  shake256_finalize(&state);
+  shake256_squeeze(mu, MLDSA_CRHBYTES, &state);
+}
+
+/*************************************************
+ * Name:        mld_verify_w1
+ *
+ * Description: Reconstructs w1 = UseHint(h, Az - c*t1*2^d) and packs it.
+ *              The challenge polynomial cp is given in normal domain and
+ *              z is transformed to NTT domain in place. t1 and w1 are
+ *              scratch space.
+ **************************************************/
+static void mld_verify_w1(uint8_t buf[MLDSA_K * MLDSA_POLYW1_PACKEDBYTES],
+                          const mld_expanded_pk *epk, polyvecl *z,
+                          const polyveck *h, poly *cp, polyveck *t1,
+                          polyveck *w1)
+{
+  /* Matrix-vector multiplication; compute Az - c2^dt1 */
+  polyvecl_ntt(z);
+  polyvec_matrix_pointwise_montgomery(w1, &epk->mat, z);
+
+  poly_ntt(cp);
+  polyveck_pointwise_poly_montgomery(t1, cp, &epk->t1hat);
+
+  polyveck_sub(w1, w1, t1);
+  polyveck_reduce(w1);
+  polyveck_invntt_tomont(w1);
+
+  /* Reconstruct w1 */
+  polyveck_caddq(w1);
+  polyveck_use_hint(w1, w1, h);
+  polyveck_pack_w1(buf, w1);
+}
+
+/*************************************************
+ * Name:        mld_verify_expanded_ws
+ *
+ * Description: Verification with an expanded public key, with the large
+ *              temporaries kept in caller-provided scratch space.
+ **************************************************/
+static int mld_verify_expanded_ws(const uint8_t *sig, size_t siglen,
+                                  const uint8_t *m, size_t mlen,
+                                  const uint8_t *pre, size_t prelen,
+                                  const mld_expanded_pk *epk, int externalmu,
+                                  mld_verify_scratch *ws)
 {
   unsigned int i;
   uint8_t buf[MLDSA_K * MLDSA_POLYW1_PACKEDBYTES];
-  uint8_t rho[MLDSA_SEEDBYTES];
   uint8_t mu[MLDSA_CRHBYTES];
   uint8_t c[MLDSA_CTILDEBYTES];
   uint8_t c2[MLDSA_CTILDEBYTES];
-  poly cp;
-  polyvecl mat[MLDSA_K], z;
-  polyveck t1, w1, h;
   keccak_state state;
 
   if (siglen != CRYPTO_BYTES)
@@ -280,12 +1060,11 @@ int crypto_sign_verify_internal(const uint8_t *sig, size_t siglen,
     return -1;
   }
 
-  unpack_pk(rho, &t1, pk);
-  if (unpack_sig(c, &z, &h, sig))
+  if (unpack_sig(c, &ws->z, &ws->h, sig))
   {
     return -1;
   }
-  if (polyvecl_chknorm(&z, MLDSA_GAMMA1 - MLDSA_BETA))
+  if (polyvecl_chknorm(&ws->z, MLDSA_GAMMA1 - MLDSA_BETA))
   {
     return -1;
   }
@@ -293,13 +1072,7 @@ int crypto_sign_verify_internal(const uint8_t *sig, size_t siglen,
   if (!externalmu)
   {
     /* Compute CRH(H(rho, t1), pre, msg) */
-    shake256(mu, MLDSA_TRBYTES, pk, CRYPTO_PUBLICKEYBYTES);
-    shake256_init(&state);
-    shake256_absorb(&state, mu, MLDSA_TRBYTES);
-    shake256_absorb(&state, pre, prelen);
-    shake256_absorb(&state, m, mlen);
-    shake256_finalize(&state);
-    shake256_squeeze(mu, MLDSA_CRHBYTES, &state);
+    mld_verify_mu(mu, &epk->tr_state, pre, prelen, m, mlen);
   }
   else
   {
@@ -307,26 +1080,8 @@ int crypto_sign_verify_internal(const uint8_t *sig, size_t siglen,
     memcpy(mu, m, MLDSA_CRHBYTES);
   }
 
-  /* Matrix-vector multiplication; compute Az - c2^dt1 */
-  poly_challenge(&cp, c);
-  polyvec_matrix_expand(mat, rho);
-
-  polyvecl_ntt(&z);
-  polyvec_matrix_pointwise_montgomery(&w1, mat, &z);
-
-  poly_ntt(&cp);
-  polyveck_shiftl(&t1);
-  polyveck_ntt(&t1);
-  polyveck_pointwise_poly_montgomery(&t1, &cp, &t1);
-
-  polyveck_sub(&w1, &w1, &t1);
-  polyveck_reduce(&w1);
-  polyveck_invntt_tomont(&w1);
-
-  /* Reconstruct w1 */
-  polyveck_caddq(&w1);
-  polyveck_use_hint(&w1, &w1, &h);
-  polyveck_pack_w1(buf, &w1);
+  poly_challenge(&ws->cp, c);
+  mld_verify_w1(buf, epk, &ws->z, &ws->h, &ws->cp, &ws->t1, &ws->w1);
 
   /* Call random oracle and verify challenge */
   shake256_init(&state);
@@ -345,27 +1100,166 @@ int crypto_sign_verify_internal(const uint8_t *sig, size_t siglen,
   return 0;
 }
 
+int crypto_sign_verify_expanded_internal(const uint8_t *sig, size_t siglen,
+                                         const uint8_t *m, size_t mlen,
+                                         const uint8_t *pre, size_t prelen,
+                                         const mld_expanded_pk *epk,
+                                         int externalmu)
+{
+  mld_verify_scratch ws;
+  return mld_verify_expanded_ws(sig, siglen, m, mlen, pre, prelen, epk,
+                                externalmu, &ws);
+}
+
+int crypto_sign_verify_batch_internal(const uint8_t *const *sigs,
+                                      const size_t *siglens,
+                                      const uint8_t *const *ms,
+                                      const size_t *mlens, size_t n,
+                                      const uint8_t *pre, size_t prelen,
+                                      const uint8_t *pk, int *results)
+{
+  size_t i, idx[4];
+  unsigned int j, l;
+  int valid[4];
+  int ret = 0;
+  uint8_t diff;
+  /* Random oracle input mu || w1 for each lane */
+  uint8_t buf[4][MLDSA_CRHBYTES + MLDSA_K * MLDSA_POLYW1_PACKEDBYTES];
+  uint8_t c[4][MLDSA_CTILDEBYTES];
+  uint8_t c2[4][SHAKE256_RATE];
+  poly cp[4];
+  polyvecl z;
+  polyveck h, t1, w1;
+  keccakx4_state statex4;
+  mld_expanded_pk epk;
+
+  /* Unpack public key and expand matrix once for the whole batch */
+  crypto_sign_expand_pk(&epk, pk);
+
+  for (i = 0; i < n; i += 4)
+  {
+    /* Fill a final incomplete group by repeating its last signature */
+    for (l = 0; l < 4; l++)
+    {
+      idx[l] = (i + l < n) ? i + l : n - 1;
+      valid[l] = siglens[idx[l]] == CRYPTO_BYTES &&
+                 !unpack_sig(c[l], &z, &h, sigs[idx[l]]) &&
+                 !polyvecl_chknorm(&z, MLDSA_GAMMA1 - MLDSA_BETA);
+      if (valid[l])
+      {
+        mld_verify_mu(buf[l], &epk.tr_state, pre, prelen, ms[idx[l]],
+                      mlens[idx[l]]);
+      }
+      else
+      {
+        /* Keep the lane well-defined; its result is discarded */
+        memset(c[l], 0, MLDSA_CTILDEBYTES);
+        memset(buf[l], 0, sizeof(buf[l]));
+      }
+    }
+
+    poly_challenge_4x(&cp[0], &cp[1], &cp[2], &cp[3], c[0], c[1], c[2], c[3]);
+
+    for (l = 0; l < 4; l++)
+    {
+      if (valid[l])
+      {
+        /* Unpack again rather than keeping four signatures in memory */
+        unpack_sig(c[l], &z, &h, sigs[idx[l]]);
+        mld_verify_w1(buf[l] + MLDSA_CRHBYTES, &epk, &z, &h, &cp[l], &t1,
+                      &w1);
+      }
+    }
+
+    /* Call random oracle for all four lanes and verify challenges */
+    shake256x4_absorb_once(&statex4, buf[0], buf[1], buf[2], buf[3],
+                           sizeof(buf[0]));
+    shake256x4_squeezeblocks(c2[0], c2[1], c2[2], c2[3], 1, &statex4);
+
+    for (l = 0; l < 4 && i + l < n; l++)
+    {
+      diff = 0;
+      for (j = 0; j < MLDSA_CTILDEBYTES; ++j)
+      {
+        diff |= c[l][j] ^ c2[l][j];
+      }
+      results[i + l] = (valid[l] && diff == 0) ? 0 : -1;
+      if (results[i + l] != 0)
+      {
+        ret = -1;
+      }
+    }
+  }
+
+  return ret;
+}
+
 int crypto_sign_verify(const uint8_t *sig, size_t siglen, const uint8_t *m,
                        size_t mlen, const uint8_t *ctx, size_t ctxlen,
                        const uint8_t *pk)
+{
+  uint8_t pre[MLD_PRE_MAXBYTES];
+
+  if (mld_prepare_pre(pre, ctx, ctxlen))
+  {
+    return -1;
+  }
+
+  return crypto_sign_verify_internal(sig, siglen, m, mlen, pre, 2 + ctxlen, pk,
+                                     0);
+}
+
+int crypto_sign_verify_expanded(const uint8_t *sig, size_t siglen,
+                                const uint8_t *m, size_t mlen,
+                                const uint8_t *ctx, size_t ctxlen,
+                                const mld_expanded_pk *epk)
+{
+  uint8_t pre[MLD_PRE_MAXBYTES];
+
+  if (mld_prepare_pre(pre, ctx, ctxlen))
+  {
+    return -1;
+  }
+
+  return crypto_sign_verify_expanded_internal(sig, siglen, m, mlen, pre,
+                                              2 + ctxlen, epk, 0);
+}
+
+int crypto_sign_verify_batch(const uint8_t *const *sigs, const size_t *siglens,
+                             const uint8_t *const *ms, const size_t *mlens,
+                             size_t n, const uint8_t *ctx, size_t ctxlen,
+                             const uint8_t *pk, int *results)
 {
   size_t i;
-  uint8_t pre[257];
+  uint8_t pre[MLD_PRE_MAXBYTES];
 
-  if (ctxlen > 255)
+  if (mld_prepare_pre(pre, ctx, ctxlen))
   {
+    for (i = 0; i < n; i++)
+    {
+      results[i] = -1;
+    }
     return -1;
   }
 
-  pre[0] = 0;
-  pre[1] = ctxlen;
-  for (i = 0; i < ctxlen; i++)
+  return crypto_sign_verify_batch_internal(sigs, siglens, ms, mlens, n, pre,
+                                           2 + ctxlen, pk, results);
+}
+
+int crypto_sign_verify_ws(const uint8_t *sig, size_t siglen, const uint8_t *m,
+                          size_t mlen, const uint8_t *ctx, size_t ctxlen,
+                          const uint8_t *pk, mld_workspace *ws)
+{
+  uint8_t pre[MLD_PRE_MAXBYTES];
+
+  if (siglen != CRYPTO_BYTES || mld_prepare_pre(pre, ctx, ctxlen))
   {
-    pre[2 + i] = ctx[i];
+    return -1;
   }
 
-  return crypto_sign_verify_internal(sig, siglen, m, mlen, pre, 2 + ctxlen, pk,
-                                     0);
+  crypto_sign_expand_pk(&ws->u.verify.epk, pk);
+  return mld_verify_expanded_ws(sig, siglen, m, mlen, pre, 2 + ctxlen,
+                                &ws->u.verify.epk, 0, &ws->u.verify.scratch);
 }
 
 int crypto_sign_verify_extmu(const uint8_t *sig, size_t siglen,
@@ -375,6 +1269,59 @@ int crypto_sign_verify_extmu(const uint8_t *sig, size_t siglen,
   return crypto_sign_verify_internal(sig, siglen, mu, 0, NULL, 0, pk, 1);
 }
 
+/*
+ * mld_verify_ctx is allocated by users of the public API, see api.h. As
+ * for mld_sign_ctx, CRYPTO_VERIFYCTXBYTES is an upper bound.
+ */
+typedef char mld_verify_ctx_size_check
+    [(sizeof(mld_verify_ctx) <= CRYPTO_VERIFYCTXBYTES) ? 1 : -1];
+
+int crypto_verify_init(mld_verify_ctx *vctx, const uint8_t *pk,
+                       const uint8_t *ctx, size_t ctxlen)
+{
+  uint8_t pre[2];
+  uint8_t tr[MLDSA_TRBYTES];
+
+  if (ctxlen > 255)
+  {
+    return -1;
+  }
+
+  pre[0] = 0;
+  pre[1] = ctxlen;
+
+  /* Start computing CRH(H(rho, t1), pre, msg) */
+  memcpy(vctx->pk, pk, CRYPTO_PUBLICKEYBYTES);
+  shake256(tr, MLDSA_TRBYTES, pk, CRYPTO_PUBLICKEYBYTES);
+  shake256_init(&vctx->state);
+  shake256_absorb(&vctx->state, tr, MLDSA_TRBYTES);
+  shake256_absorb(&vctx->state, pre, 2);
+  shake256_absorb(&vctx->state, ctx, ctxlen);
+  return 0;
+}
+
+int crypto_verify_update(mld_verify_ctx *vctx, const uint8_t *m, size_t mlen)
+{
+  shake256_absorb(&vctx->state, m, mlen);
+  return 0;
+}
+
+int crypto_verify_final(mld_verify_ctx *vctx, const uint8_t *sig,
+                        size_t siglen)
+{
+  uint8_t mu[MLDSA_CRHBYTES];
+  mld_expanded_pk epk;
+
+  shake256_finalize(&vctx->state);
+  shake256_squeeze(mu, MLDSA_CRHBYTES, &vctx->state);
+
+  /* tr = H(pk) has been absorbed by crypto_verify_init; verify against mu
+   * without hashing the public key again */
+  mld_expand_pk_polys(&epk, vctx->pk);
+  return crypto_sign_verify_expanded_internal(sig, siglen, mu, 0, NULL, 0,
+                                              &epk, 1);
+}
+
 int crypto_sign_open(uint8_t *m, size_t *mlen, const uint8_t *sm, size_t smlen,
                      const uint8_t *ctx, size_t ctxlen, const uint8_t *pk)
 {
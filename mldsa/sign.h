@@ -8,8 +8,139 @@
 #include <stddef.h>
 #include <stdint.h>
 #include "common.h"
+#include "fips202/fips202.h"
 #include "poly.h"
 #include "polyvec.h"
+#if defined(MLD_CONFIG_SIGN_STATS)
+#include "sign_stats.h"
+#endif /* MLD_CONFIG_SIGN_STATS */
+
+/*
+ * Secret key in expanded form, with all data depending only on the
+ * secret key precomputed: rho, the SHAKE256 states after absorbing tr and
+ * key, which prefix every computation of mu and rhoprime, the matrix A and
+ * the vectors s1, s2 and t0, in NTT domain unless sparse_challenge is set.
+ * With MLD_CONFIG_REDUCE_RAM, the matrix A is not stored but sampled on
+ * demand, see polymat.
+ *
+ * sparse_challenge selects how the challenge is multiplied with s1, s2
+ * and t0: by sparse multiplication in normal domain (poly_sparse_mul), or
+ * in NTT domain. On x86_64, the sparse path takes 2-3x fewer cycles than
+ * the C inverse NTT for all parameter sets, but about twice as many as the
+ * AVX2 inverse NTT; see the challenge_mul_* benchmarks in
+ * bench_components_mldsa.c. crypto_sign_expand_sk therefore sets it
+ * unless a native inverse NTT is usable on the running CPU.
+ *
+ * Users of the public API (api.h) treat this structure as opaque and
+ * allocate CRYPTO_EXPANDEDSKBYTES bytes for it, an upper bound on its size.
+ */
+typedef struct MLD_NAMESPACE(expanded_sk)
+{
+  uint8_t rho[MLDSA_SEEDBYTES];
+  keccak_state tr_state;
+  keccak_state key_state;
+  polymat mat;
+  polyvecl s1;
+  polyveck s2;
+  polyveck t0;
+  int sparse_challenge;
+} mld_expanded_sk;
+
+/*
+ * Public key in expanded form, with all data depending only on the
+ * public key precomputed: the SHAKE256 state after absorbing tr = H(pk),
+ * the matrix A and NTT(t1 * 2^d).
+ *
+ * Users of the public API (api.h) treat this structure as opaque and
+ * allocate CRYPTO_EXPANDEDPKBYTES bytes for it, an upper bound on its size.
+ */
+typedef struct MLD_NAMESPACE(expanded_pk)
+{
+  keccak_state tr_state;
+  polymat mat;
+  polyveck t1hat;
+} mld_expanded_pk;
+
+/*
+ * State of an incremental signing operation, see crypto_sign_init: the
+ * SHAKE256 state computing mu = CRH(tr, pre, msg) and a copy of the
+ * secret key. crypto_sign_final clears it; callers abandoning an operation
+ * before crypto_sign_final must clear it themselves.
+ *
+ * Users of the public API (api.h) treat this structure as opaque and
+ * allocate CRYPTO_SIGNCTXBYTES bytes for it.
+ */
+typedef struct MLD_NAMESPACE(sign_ctx)
+{
+  keccak_state state;
+  uint8_t sk[CRYPTO_SECRETKEYBYTES];
+} mld_sign_ctx;
+
+/*
+ * State of an incremental verification, see crypto_verify_init: the
+ * SHAKE256 state computing mu = CRH(tr, pre, msg) and a copy of the
+ * public key.
+ *
+ * Users of the public API (api.h) treat this structure as opaque and
+ * allocate CRYPTO_VERIFYCTXBYTES bytes for it.
+ */
+typedef struct MLD_NAMESPACE(verify_ctx)
+{
+  keccak_state state;
+  uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+} mld_verify_ctx;
+
+/* Large temporaries of key generation */
+typedef struct
+{
+  polymat mat;
+  polyvecl s1, s1hat;
+  polyveck s2, t1, t0;
+} mld_keypair_scratch;
+
+/* Large temporaries of the signing rejection loop */
+typedef struct
+{
+  polyvecl y, z;
+  polyveck w1, w0, h;
+  poly cp;
+} mld_sign_scratch;
+
+/* Large temporaries of verification */
+typedef struct
+{
+  polyvecl z;
+  polyveck h, t1, w1;
+  poly cp;
+} mld_verify_scratch;
+
+/*
+ * Caller-provided scratch memory for the _ws variants of key generation,
+ * signing and verification, holding all polynomial data which would
+ * otherwise live on the stack. Only one operation can use a workspace at
+ * a time; it holds no state between calls.
+ *
+ * Users of the public API (api.h) treat this structure as opaque and
+ * allocate CRYPTO_WORKSPACEBYTES bytes for it, an upper bound on its size,
+ * aligned for uint64_t.
+ */
+typedef struct MLD_NAMESPACE(workspace)
+{
+  union
+  {
+    mld_keypair_scratch keypair;
+    struct
+    {
+      mld_expanded_sk esk;
+      mld_sign_scratch scratch;
+    } sign;
+    struct
+    {
+      mld_expanded_pk epk;
+      mld_verify_scratch scratch;
+    } verify;
+  } u;
+} mld_workspace;
 
 #define crypto_sign_keypair_internal MLD_NAMESPACE(keypair_internal)
 /*************************************************
@@ -46,6 +177,23 @@ int crypto_sign_keypair_internal(uint8_t *pk, uint8_t *sk,
  **************************************************/
 int crypto_sign_keypair(uint8_t *pk, uint8_t *sk);
 
+#define crypto_sign_keypair_ws MLD_NAMESPACE(keypair_ws)
+/*************************************************
+ * Name:        crypto_sign_keypair_ws
+ *
+ * Description: As crypto_sign_keypair, but keeps all polynomial data in
+ *              the caller-provided workspace instead of on the stack.
+ *
+ * Arguments:   - uint8_t *pk:       pointer to output public key (allocated
+ *                                   array of CRYPTO_PUBLICKEYBYTES bytes)
+ *              - uint8_t *sk:       pointer to output private key (allocated
+ *                                   array of CRYPTO_SECRETKEYBYTES bytes)
+ *              - mld_workspace *ws: pointer to workspace
+ *
+ * Returns 0 (success)
+ **************************************************/
+int crypto_sign_keypair_ws(uint8_t *pk, uint8_t *sk, mld_workspace *ws);
+
 #define crypto_sign_signature_internal MLD_NAMESPACE(signature_internal)
 /*************************************************
  * Name:        crypto_sign_signature_internal
@@ -63,7 +211,8 @@ int crypto_sign_keypair(uint8_t *pk, uint8_t *sk);
  *              - uint8_t *sk:    pointer to bit-packed secret key
  *              - int externalmu: indicates input message m is processed as mu
  *
- * Returns 0 (success)
+ * Returns 0 (success) or -1 (failure to set up the signing threads, see
+ * MLD_CONFIG_SIGN_THREADS). On failure, sig is cleared and *siglen set to 0.
  **************************************************/
 int crypto_sign_signature_internal(uint8_t *sig, size_t *siglen,
                                    const uint8_t *m, size_t mlen,
@@ -71,6 +220,51 @@ int crypto_sign_signature_internal(uint8_t *sig, size_t *siglen,
                                    const uint8_t rnd[MLDSA_RNDBYTES],
                                    const uint8_t *sk, int externalmu);
 
+#define crypto_sign_expand_sk MLD_NAMESPACE(expand_sk)
+/*************************************************
+ * Name:        crypto_sign_expand_sk
+ *
+ * Description: Expands a bit-packed secret key for repeated signing.
+ *              Unpacks the secret key, expands the matrix A and, unless
+ *              the sparse challenge multiplication is selected for this
+ *              CPU (see mld_expanded_sk), transforms s1, s2 and t0 to NTT
+ *              domain, so that signing with the expanded key skips these
+ *              steps.
+ *
+ * Arguments:   - mld_expanded_sk *esk: pointer to output expanded secret key
+ *              - const uint8_t *sk:    pointer to bit-packed secret key
+ *
+ * Returns 0 (success)
+ **************************************************/
+int crypto_sign_expand_sk(mld_expanded_sk *esk, const uint8_t *sk);
+
+#define crypto_sign_signature_expanded_internal \
+  MLD_NAMESPACE(signature_expanded_internal)
+/*************************************************
+ * Name:        crypto_sign_signature_expanded_internal
+ *
+ * Description: Computes signature using an expanded secret key.
+ *              Internal API.
+ *
+ * Arguments:   - uint8_t *sig:   pointer to output signature (of length
+ *                                CRYPTO_BYTES)
+ *              - size_t *siglen: pointer to output length of signature
+ *              - uint8_t *m:     pointer to message to be signed
+ *              - size_t mlen:    length of message
+ *              - uint8_t *pre:   pointer to prefix string
+ *              - size_t prelen:  length of prefix string
+ *              - uint8_t *rnd:   pointer to random seed
+ *              - const mld_expanded_sk *esk: pointer to expanded secret key
+ *              - int externalmu: indicates input message m is processed as mu
+ *
+ * Returns 0 (success) or -1 (failure to set up the signing threads, see
+ * MLD_CONFIG_SIGN_THREADS). On failure, sig is cleared and *siglen set to 0.
+ **************************************************/
+int crypto_sign_signature_expanded_internal(
+    uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen,
+    const uint8_t *pre, size_t prelen, const uint8_t rnd[MLDSA_RNDBYTES],
+    const mld_expanded_sk *esk, int externalmu);
+
 #define crypto_sign_signature MLD_NAMESPACE(signature)
 /*************************************************
  * Name:        crypto_sign_signature
@@ -87,12 +281,65 @@ int crypto_sign_signature_internal(uint8_t *sig, size_t *siglen,
  *              - size_t ctxlen:  length of contex string
  *              - uint8_t *sk:    pointer to bit-packed secret key
  *
- * Returns 0 (success) or -1 (context string too long)
+ * Returns 0 (success) or -1 (context string too long, or failure to set
+ * up the signing threads, see MLD_CONFIG_SIGN_THREADS). If signing fails,
+ * sig is cleared and *siglen set to 0.
  **************************************************/
 int crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m,
                           size_t mlen, const uint8_t *ctx, size_t ctxlen,
                           const uint8_t *sk);
 
+#define crypto_sign_signature_expanded MLD_NAMESPACE(signature_expanded)
+/*************************************************
+ * Name:        crypto_sign_signature_expanded
+ *
+ * Description: FIPS 204: Algorithm 2 ML-DSA.Sign, using a secret key
+ *              expanded with crypto_sign_expand_sk.
+ *              Computes signature.
+ *
+ * Arguments:   - uint8_t *sig:   pointer to output signature (of length
+ *                                CRYPTO_BYTES)
+ *              - size_t *siglen: pointer to output length of signature
+ *              - uint8_t *m:     pointer to message to be signed
+ *              - size_t mlen:    length of message
+ *              - uint8_t *ctx:   pointer to contex string
+ *              - size_t ctxlen:  length of contex string
+ *              - const mld_expanded_sk *esk: pointer to expanded secret key
+ *
+ * Returns 0 (success) or -1 (context string too long, or failure to set
+ * up the signing threads, see MLD_CONFIG_SIGN_THREADS). If signing fails,
+ * sig is cleared and *siglen set to 0.
+ **************************************************/
+int crypto_sign_signature_expanded(uint8_t *sig, size_t *siglen,
+                                   const uint8_t *m, size_t mlen,
+                                   const uint8_t *ctx, size_t ctxlen,
+                                   const mld_expanded_sk *esk);
+
+#define crypto_sign_signature_ws MLD_NAMESPACE(signature_ws)
+/*************************************************
+ * Name:        crypto_sign_signature_ws
+ *
+ * Description: As crypto_sign_signature, but keeps all polynomial data,
+ *              including the expanded secret key, in the caller-provided
+ *              workspace instead of on the stack.
+ *
+ * Arguments:   - uint8_t *sig:       pointer to output signature (of length
+ *                                    CRYPTO_BYTES)
+ *              - size_t *siglen:     pointer to output length of signature
+ *              - uint8_t *m:         pointer to message to be signed
+ *              - size_t mlen:        length of message
+ *              - uint8_t *ctx:       pointer to context string
+ *              - size_t ctxlen:      length of context string
+ *              - uint8_t *sk:        pointer to bit-packed secret key
+ *              - mld_workspace *ws:  pointer to workspace
+ *
+ * Returns 0 (success) or -1 (context string too long). If signing
+ * fails, sig is cleared and *siglen set to 0.
+ **************************************************/
+int crypto_sign_signature_ws(uint8_t *sig, size_t *siglen, const uint8_t *m,
+                             size_t mlen, const uint8_t *ctx, size_t ctxlen,
+                             const uint8_t *sk, mld_workspace *ws);
+
 #define crypto_sign_signature_extmu MLD_NAMESPACE(signature_extmu)
 /*************************************************
  * Name:        crypto_sign_signature_extmu
@@ -106,12 +353,67 @@ int crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m,
  *              - uint8_t mu:     input mu to be signed of size MLDSA_CRHBYTES
  *              - uint8_t *sk:    pointer to bit-packed secret key
  *
- * Returns 0 (success) or -1 (context string too long)
+ * Returns 0 (success) or -1 (failure to set up the signing threads, see
+ * MLD_CONFIG_SIGN_THREADS). On failure, sig is cleared and *siglen set to 0.
  **************************************************/
 int crypto_sign_signature_extmu(uint8_t *sig, size_t *siglen,
                                 const uint8_t mu[MLDSA_CRHBYTES],
                                 const uint8_t *sk);
 
+#define crypto_sign_init MLD_NAMESPACE(sign_init)
+/*************************************************
+ * Name:        crypto_sign_init
+ *
+ * Description: Starts an incremental signing operation, for messages that
+ *              are not available in memory at once. The message is passed
+ *              in chunks to crypto_sign_update, and the signature is
+ *              computed by crypto_sign_final. The result is a signature as
+ *              computed by crypto_sign_signature on the whole message.
+ *
+ * Arguments:   - mld_sign_ctx *sctx: pointer to output signing state
+ *              - const uint8_t *sk:  pointer to bit-packed secret key
+ *              - const uint8_t *ctx: pointer to context string
+ *              - size_t ctxlen:      length of context string
+ *
+ * Returns 0 (success) or -1 (context string too long)
+ **************************************************/
+int crypto_sign_init(mld_sign_ctx *sctx, const uint8_t *sk,
+                     const uint8_t *ctx, size_t ctxlen);
+
+#define crypto_sign_update MLD_NAMESPACE(sign_update)
+/*************************************************
+ * Name:        crypto_sign_update
+ *
+ * Description: Absorbs the next chunk of the message to be signed.
+ *
+ * Arguments:   - mld_sign_ctx *sctx: pointer to signing state
+ *              - const uint8_t *m:   pointer to message chunk
+ *              - size_t mlen:        length of message chunk
+ *
+ * Returns 0 (success)
+ **************************************************/
+int crypto_sign_update(mld_sign_ctx *sctx, const uint8_t *m, size_t mlen);
+
+#define crypto_sign_final MLD_NAMESPACE(sign_final)
+/*************************************************
+ * Name:        crypto_sign_final
+ *
+ * Description: Finishes an incremental signing operation and computes the
+ *              signature of the absorbed message. The signing state,
+ *              including its copy of the secret key, is zeroized, also if
+ *              signing fails. It must not be used afterwards without
+ *              calling crypto_sign_init.
+ *
+ * Arguments:   - mld_sign_ctx *sctx: pointer to signing state
+ *              - uint8_t *sig:   pointer to output signature (of length
+ *                                CRYPTO_BYTES)
+ *              - size_t *siglen: pointer to output length of signature
+ *
+ * Returns 0 (success) or -1 (failure to set up the signing threads, see
+ * MLD_CONFIG_SIGN_THREADS). On failure, sig is cleared and *siglen set to 0.
+ **************************************************/
+int crypto_sign_final(mld_sign_ctx *sctx, uint8_t *sig, size_t *siglen);
+
 #define crypto_sign MLD_NAMESPACETOP
 /*************************************************
  * Name:        crypto_sign
@@ -129,11 +431,41 @@ int crypto_sign_signature_extmu(uint8_t *sig, size_t *siglen,
  *              - size_t ctxlen: length of context string
  *              - const uint8_t *sk: pointer to bit-packed secret key
  *
- * Returns 0 (success) or -1 (context string too long)
+ * Returns 0 (success) or -1 (context string too long, or failure to set
+ * up the signing threads, see MLD_CONFIG_SIGN_THREADS). If signing fails,
+ * the signature is cleared and *smlen set to 0.
  **************************************************/
 int crypto_sign(uint8_t *sm, size_t *smlen, const uint8_t *m, size_t mlen,
                 const uint8_t *ctx, size_t ctxlen, const uint8_t *sk);
 
+#if defined(MLD_CONFIG_SIGN_STATS)
+/*
+ * Statistics of the rejection loop of signing, see MLD_CONFIG_SIGN_STATS.
+ * Defined once in sign_stats.h, which the public API (api.h) shares.
+ */
+typedef struct MLD_NAMESPACE_SHARED(sign_stats) mld_sign_stats;
+
+#define crypto_sign_stats MLD_NAMESPACE(sign_stats)
+/*************************************************
+ * Name:        crypto_sign_stats
+ *
+ * Description: Reads the rejection loop statistics of the signing
+ *              operations of the calling thread since it started or since
+ *              the last call to crypto_sign_stats_reset.
+ *
+ * Arguments:   - mld_sign_stats *stats: pointer to output statistics
+ **************************************************/
+void crypto_sign_stats(mld_sign_stats *stats);
+
+#define crypto_sign_stats_reset MLD_NAMESPACE(sign_stats_reset)
+/*************************************************
+ * Name:        crypto_sign_stats_reset
+ *
+ * Description: Resets the rejection loop statistics of the calling thread.
+ **************************************************/
+void crypto_sign_stats_reset(void);
+#endif /* MLD_CONFIG_SIGN_STATS */
+
 #define crypto_sign_verify_internal MLD_NAMESPACE(verify_internal)
 /*************************************************
  * Name:        crypto_sign_verify_internal
@@ -156,6 +488,80 @@ int crypto_sign_verify_internal(const uint8_t *sig, size_t siglen,
                                 const uint8_t *pre, size_t prelen,
                                 const uint8_t *pk, int externalmu);
 
+#define crypto_sign_expand_pk MLD_NAMESPACE(expand_pk)
+/*************************************************
+ * Name:        crypto_sign_expand_pk
+ *
+ * Description: Expands a bit-packed public key for repeated verification.
+ *              Computes tr = H(pk), expands the matrix A and computes
+ *              NTT(t1 * 2^d), so that verification with the expanded key
+ *              skips these steps.
+ *
+ * Arguments:   - mld_expanded_pk *epk: pointer to output expanded public key
+ *              - const uint8_t *pk:    pointer to bit-packed public key
+ *
+ * Returns 0 (success)
+ **************************************************/
+int crypto_sign_expand_pk(mld_expanded_pk *epk, const uint8_t *pk);
+
+#define crypto_sign_verify_expanded_internal \
+  MLD_NAMESPACE(verify_expanded_internal)
+/*************************************************
+ * Name:        crypto_sign_verify_expanded_internal
+ *
+ * Description: Verifies signature using an expanded public key.
+ *              Internal API.
+ *
+ * Arguments:   - uint8_t *sig: pointer to input signature
+ *              - size_t siglen: length of signature
+ *              - const uint8_t *m: pointer to message
+ *              - size_t mlen: length of message
+ *              - const uint8_t *pre: pointer to prefix string
+ *              - size_t prelen: length of prefix string
+ *              - const mld_expanded_pk *epk: pointer to expanded public key
+ *              - int externalmu: indicates input message m is processed as mu
+ *
+ * Returns 0 if signature could be verified correctly and -1 otherwise
+ **************************************************/
+int crypto_sign_verify_expanded_internal(const uint8_t *sig, size_t siglen,
+                                         const uint8_t *m, size_t mlen,
+                                         const uint8_t *pre, size_t prelen,
+                                         const mld_expanded_pk *epk,
+                                         int externalmu);
+
+#define crypto_sign_verify_batch_internal MLD_NAMESPACE(verify_batch_internal)
+/*************************************************
+ * Name:        crypto_sign_verify_batch_internal
+ *
+ * Description: Verifies n signatures under the same public key.
+ *              Internal API.
+ *
+ *              The public key is unpacked and expanded only once, and the
+ *              challenge sampling and final SHAKE256 call of four
+ *              signatures at a time run in parallel.
+ *
+ * Arguments:   - const uint8_t *const *sigs: array of n pointers to input
+ *                signatures
+ *              - const size_t *siglens: array of n signature lengths
+ *              - const uint8_t *const *ms: array of n pointers to messages
+ *              - const size_t *mlens: array of n message lengths
+ *              - size_t n: number of signatures
+ *              - const uint8_t *pre: pointer to prefix string
+ *              - size_t prelen: length of prefix string
+ *              - const uint8_t *pk: pointer to bit-packed public key
+ *              - int *results: array of n outputs; results[i] is set to 0
+ *                if the i-th signature could be verified correctly and to
+ *                -1 otherwise
+ *
+ * Returns 0 if all signatures could be verified correctly and -1 otherwise
+ **************************************************/
+int crypto_sign_verify_batch_internal(const uint8_t *const *sigs,
+                                      const size_t *siglens,
+                                      const uint8_t *const *ms,
+                                      const size_t *mlens, size_t n,
+                                      const uint8_t *pre, size_t prelen,
+                                      const uint8_t *pk, int *results);
+
 #define crypto_sign_verify MLD_NAMESPACE(verify)
 /*************************************************
  * Name:        crypto_sign_verify
@@ -177,6 +583,80 @@ int crypto_sign_verify(const uint8_t *sig, size_t siglen, const uint8_t *m,
                        size_t mlen, const uint8_t *ctx, size_t ctxlen,
                        const uint8_t *pk);
 
+#define crypto_sign_verify_expanded MLD_NAMESPACE(verify_expanded)
+/*************************************************
+ * Name:        crypto_sign_verify_expanded
+ *
+ * Description: FIPS 204: Algorithm 3 ML-DSA.Verify, using a public key
+ *              expanded with crypto_sign_expand_pk.
+ *              Verifies signature.
+ *
+ * Arguments:   - uint8_t *sig: pointer to input signature
+ *              - size_t siglen: length of signature
+ *              - const uint8_t *m: pointer to message
+ *              - size_t mlen: length of message
+ *              - const uint8_t *ctx: pointer to context string
+ *              - size_t ctxlen: length of context string
+ *              - const mld_expanded_pk *epk: pointer to expanded public key
+ *
+ * Returns 0 if signature could be verified correctly and -1 otherwise
+ **************************************************/
+int crypto_sign_verify_expanded(const uint8_t *sig, size_t siglen,
+                                const uint8_t *m, size_t mlen,
+                                const uint8_t *ctx, size_t ctxlen,
+                                const mld_expanded_pk *epk);
+
+#define crypto_sign_verify_batch MLD_NAMESPACE(verify_batch)
+/*************************************************
+ * Name:        crypto_sign_verify_batch
+ *
+ * Description: FIPS 204: Algorithm 3 ML-DSA.Verify, applied to n signatures
+ *              under the same public key and context string.
+ *              Equivalent to n calls to crypto_sign_verify, but faster.
+ *
+ * Arguments:   - const uint8_t *const *sigs: array of n pointers to input
+ *                signatures
+ *              - const size_t *siglens: array of n signature lengths
+ *              - const uint8_t *const *ms: array of n pointers to messages
+ *              - const size_t *mlens: array of n message lengths
+ *              - size_t n: number of signatures
+ *              - const uint8_t *ctx: pointer to context string
+ *              - size_t ctxlen: length of context string
+ *              - const uint8_t *pk: pointer to bit-packed public key
+ *              - int *results: array of n outputs; results[i] is set to 0
+ *                if the i-th signature could be verified correctly and to
+ *                -1 otherwise
+ *
+ * Returns 0 if all signatures could be verified correctly and -1 otherwise
+ **************************************************/
+int crypto_sign_verify_batch(const uint8_t *const *sigs, const size_t *siglens,
+                             const uint8_t *const *ms, const size_t *mlens,
+                             size_t n, const uint8_t *ctx, size_t ctxlen,
+                             const uint8_t *pk, int *results);
+
+#define crypto_sign_verify_ws MLD_NAMESPACE(verify_ws)
+/*************************************************
+ * Name:        crypto_sign_verify_ws
+ *
+ * Description: As crypto_sign_verify, but keeps all polynomial data,
+ *              including the expanded public key, in the caller-provided
+ *              workspace instead of on the stack.
+ *
+ * Arguments:   - uint8_t *sig:       pointer to input signature
+ *              - size_t siglen:      length of signature
+ *              - const uint8_t *m:   pointer to message
+ *              - size_t mlen:        length of message
+ *              - const uint8_t *ctx: pointer to context string
+ *              - size_t ctxlen:      length of context string
+ *              - const uint8_t *pk:  pointer to bit-packed public key
+ *              - mld_workspace *ws:  pointer to workspace
+ *
+ * Returns 0 if signature could be verified correctly and -1 otherwise
+ **************************************************/
+int crypto_sign_verify_ws(const uint8_t *sig, size_t siglen, const uint8_t *m,
+                          size_t mlen, const uint8_t *ctx, size_t ctxlen,
+                          const uint8_t *pk, mld_workspace *ws);
+
 #define crypto_sign_verify_extmu MLD_NAMESPACE(verify_extmu)
 /*************************************************
  * Name:        crypto_sign_verify_extmu
@@ -195,6 +675,58 @@ int crypto_sign_verify_extmu(const uint8_t *sig, size_t siglen,
                              const uint8_t mu[MLDSA_CRHBYTES],
                              const uint8_t *pk);
 
+#define crypto_verify_init MLD_NAMESPACE(verify_init)
+/*************************************************
+ * Name:        crypto_verify_init
+ *
+ * Description: Starts an incremental verification, for messages that are
+ *              not available in memory at once. The message is passed in
+ *              chunks to crypto_verify_update, and the signature is checked
+ *              by crypto_verify_final. The result is the same as that of
+ *              crypto_sign_verify on the whole message.
+ *
+ * Arguments:   - mld_verify_ctx *vctx: pointer to output verification state
+ *              - const uint8_t *pk:    pointer to bit-packed public key
+ *              - const uint8_t *ctx:   pointer to context string
+ *              - size_t ctxlen:        length of context string
+ *
+ * Returns 0 (success) or -1 (context string too long)
+ **************************************************/
+int crypto_verify_init(mld_verify_ctx *vctx, const uint8_t *pk,
+                       const uint8_t *ctx, size_t ctxlen);
+
+#define crypto_verify_update MLD_NAMESPACE(verify_update)
+/*************************************************
+ * Name:        crypto_verify_update
+ *
+ * Description: Absorbs the next chunk of the message to be verified.
+ *
+ * Arguments:   - mld_verify_ctx *vctx: pointer to verification state
+ *              - const uint8_t *m:     pointer to message chunk
+ *              - size_t mlen:          length of message chunk
+ *
+ * Returns 0 (success)
+ **************************************************/
+int crypto_verify_update(mld_verify_ctx *vctx, const uint8_t *m, size_t mlen);
+
+#define crypto_verify_final MLD_NAMESPACE(verify_final)
+/*************************************************
+ * Name:        crypto_verify_final
+ *
+ * Description: Finishes an incremental verification and verifies the
+ *              signature on the absorbed message. The verification state
+ *              must not be used afterwards without calling
+ *              crypto_verify_init.
+ *
+ * Arguments:   - mld_verify_ctx *vctx: pointer to verification state
+ *              - const uint8_t *sig:   pointer to input signature
+ *              - size_t siglen:        length of signature
+ *
+ * Returns 0 if signature could be verified correctly and -1 otherwise
+ **************************************************/
+int crypto_verify_final(mld_verify_ctx *vctx, const uint8_t *sig,
+                        size_t siglen);
+
 #define crypto_sign_open MLD_NAMESPACE(open)
 /*************************************************
  * Name:        crypto_sign_open
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MLD_SIGN_STATS_H
+#define MLD_SIGN_STATS_H
+
+#include <stdint.h>
+
+/*
+ * Statistics of the rejection loop of signing, see MLD_CONFIG_SIGN_STATS
+ * in config.h. This is the single definition, shared by the public API
+ * (api.h) and the implementation (sign.h); it therefore only depends on
+ * <stdint.h>. The layout is the same for all parameter sets.
+ */
+
+/* Number of entries of MLD_ref_sign_stats.hist */
+#define MLD_SIGN_STATS_HISTBINS 32
+
+/*
+ * Every rejected attempt is counted once, under the first check it fails,
+ * in the order in which signing runs them.
+ */
+struct MLD_ref_sign_stats
+{
+  /* Number of signing operations */
+  uint64_t calls;
+  /* Number of attempts over all signing operations */
+  uint64_t attempts;
+  /* Number of attempts of the most recent signing operation */
+  uint64_t last_attempts;
+  /* Attempts rejected because ||z|| >= GAMMA1 - BETA */
+  uint64_t reject_z;
+  /* Attempts rejected because ||w0 - cs2|| >= GAMMA2 - BETA */
+  uint64_t reject_w0;
+  /* Attempts rejected because ||ct0|| >= GAMMA2 */
+  uint64_t reject_ct0;
+  /* Attempts rejected because the hint has more than OMEGA ones */
+  uint64_t reject_hints;
+  /* hist[i] is the number of signing operations with i + 1 attempts; the
+   * last entry also counts all operations with more attempts */
+  uint64_t hist[MLD_SIGN_STATS_HISTBINS];
+};
+
+#endif /* MLD_SIGN_STATS_H */
@@ -3,7 +3,9 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 #include <stdint.h>
+#include <string.h>
 #include "fips202/fips202.h"
+#include "fips202/fips202x4.h"
 #include "params.h"
 #include "symmetric.h"
 
@@ -21,6 +23,31 @@ void mldsa_shake128_stream_init(keccak_state *state,
   shake128_finalize(state);
 }
 
+void mldsa_shake128x4_stream_init(keccakx4_state *state,
+                                  const uint8_t seed[MLDSA_SEEDBYTES],
+                                  uint16_t nonce0, uint16_t nonce1,
+                                  uint16_t nonce2, uint16_t nonce3)
+{
+  uint8_t extseed[4][MLDSA_SEEDBYTES + 2];
+  uint16_t nonce[4];
+  unsigned int j;
+
+  nonce[0] = nonce0;
+  nonce[1] = nonce1;
+  nonce[2] = nonce2;
+  nonce[3] = nonce3;
+
+  for (j = 0; j < 4; j++)
+  {
+    memcpy(extseed[j], seed, MLDSA_SEEDBYTES);
+    extseed[j][MLDSA_SEEDBYTES + 0] = nonce[j];
+    extseed[j][MLDSA_SEEDBYTES + 1] = nonce[j] >> 8;
+  }
+
+  shake128x4_absorb_once(state, extseed[0], extseed[1], extseed[2], extseed[3],
+                         MLDSA_SEEDBYTES + 2);
+}
+
 void mldsa_shake256_stream_init(keccak_state *state,
                                 const uint8_t seed[MLDSA_CRHBYTES],
                                 uint16_t nonce)
@@ -34,3 +61,28 @@ void mldsa_shake256_stream_init(keccak_state *state,
   shake256_absorb(state, t, 2);
   shake256_finalize(state);
 }
+
+void mldsa_shake256x4_stream_init(keccakx4_state *state,
+                                  const uint8_t seed[MLDSA_CRHBYTES],
+                                  uint16_t nonce0, uint16_t nonce1,
+                                  uint16_t nonce2, uint16_t nonce3)
+{
+  uint8_t extseed[4][MLDSA_CRHBYTES + 2];
+  uint16_t nonce[4];
+  unsigned int j;
+
+  nonce[0] = nonce0;
+  nonce[1] = nonce1;
+  nonce[2] = nonce2;
+  nonce[3] = nonce3;
+
+  for (j = 0; j < 4; j++)
+  {
+    memcpy(extseed[j], seed, MLDSA_CRHBYTES);
+    extseed[j][MLDSA_CRHBYTES + 0] = nonce[j];
+    extseed[j][MLDSA_CRHBYTES + 1] = nonce[j] >> 8;
+  }
+
+  shake256x4_absorb_once(state, extseed[0], extseed[1], extseed[2], extseed[3],
+                         MLDSA_CRHBYTES + 2);
+}
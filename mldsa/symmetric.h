@@ -8,20 +8,35 @@
 #include <stdint.h>
 
 #include "fips202/fips202.h"
+#include "fips202/fips202x4.h"
 
 typedef keccak_state stream128_state;
 typedef keccak_state stream256_state;
+typedef keccakx4_state stream128x4_state;
+typedef keccakx4_state stream256x4_state;
 
 #define mldsa_shake128_stream_init MLD_NAMESPACE(mldsa_shake128_stream_init)
 void mldsa_shake128_stream_init(keccak_state *state,
                                 const uint8_t seed[MLDSA_SEEDBYTES],
                                 uint16_t nonce);
 
+#define mldsa_shake128x4_stream_init MLD_NAMESPACE(mldsa_shake128x4_stream_init)
+void mldsa_shake128x4_stream_init(keccakx4_state *state,
+                                  const uint8_t seed[MLDSA_SEEDBYTES],
+                                  uint16_t nonce0, uint16_t nonce1,
+                                  uint16_t nonce2, uint16_t nonce3);
+
 #define mldsa_shake256_stream_init MLD_NAMESPACE(mldsa_shake256_stream_init)
 void mldsa_shake256_stream_init(keccak_state *state,
                                 const uint8_t seed[MLDSA_CRHBYTES],
                                 uint16_t nonce);
 
+#define mldsa_shake256x4_stream_init MLD_NAMESPACE(mldsa_shake256x4_stream_init)
+void mldsa_shake256x4_stream_init(keccakx4_state *state,
+                                  const uint8_t seed[MLDSA_CRHBYTES],
+                                  uint16_t nonce0, uint16_t nonce1,
+                                  uint16_t nonce2, uint16_t nonce3);
+
 #define STREAM128_BLOCKBYTES SHAKE128_RATE
 #define STREAM256_BLOCKBYTES SHAKE256_RATE
 
@@ -29,9 +44,17 @@ void mldsa_shake256_stream_init(keccak_state *state,
   mldsa_shake128_stream_init(STATE, SEED, NONCE)
 #define stream128_squeezeblocks(OUT, OUTBLOCKS, STATE) \
   shake128_squeezeblocks(OUT, OUTBLOCKS, STATE)
+#define stream128x4_init(STATE, SEED, NONCE0, NONCE1, NONCE2, NONCE3) \
+  mldsa_shake128x4_stream_init(STATE, SEED, NONCE0, NONCE1, NONCE2, NONCE3)
+#define stream128x4_squeezeblocks(OUT0, OUT1, OUT2, OUT3, OUTBLOCKS, STATE) \
+  shake128x4_squeezeblocks(OUT0, OUT1, OUT2, OUT3, OUTBLOCKS, STATE)
 #define stream256_init(STATE, SEED, NONCE) \
   mldsa_shake256_stream_init(STATE, SEED, NONCE)
 #define stream256_squeezeblocks(OUT, OUTBLOCKS, STATE) \
   shake256_squeezeblocks(OUT, OUTBLOCKS, STATE)
+#define stream256x4_init(STATE, SEED, NONCE0, NONCE1, NONCE2, NONCE3) \
+  mldsa_shake256x4_stream_init(STATE, SEED, NONCE0, NONCE1, NONCE2, NONCE3)
+#define stream256x4_squeezeblocks(OUT0, OUT1, OUT2, OUT3, OUTBLOCKS, STATE) \
+  shake256x4_squeezeblocks(OUT0, OUT1, OUT2, OUT3, OUTBLOCKS, STATE)
 
 #endif /* !MLD_SYMMETRIC_H */
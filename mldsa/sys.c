@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sys.h"
+
+/* -1 until the capabilities have been detected; accessed through
+ * mld_sys_caps_load() and mld_sys_caps_store() */
+int mld_sys_caps = -1;
+
+#if defined(MLD_SYS_X86_64) && defined(MLD_HAVE_INLINE_ASM)
+static void mld_sys_cpuid(uint32_t leaf, uint32_t subleaf, uint32_t regs[4])
+{
+  __asm__ volatile("cpuid"
+                   : "=a"(regs[0]), "=b"(regs[1]), "=c"(regs[2]),
+                     "=d"(regs[3])
+                   : "a"(leaf), "c"(subleaf));
+}
+
+static uint64_t mld_sys_xgetbv(uint32_t index)
+{
+  uint32_t lo, hi;
+  __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(index));
+  return ((uint64_t)hi << 32) | lo;
+}
+
+static int mld_sys_detect(void)
+{
+  uint32_t regs[4];
+  int caps = 0;
+
+  mld_sys_cpuid(0, 0, regs);
+  if (regs[0] < 7)
+  {
+    return 0;
+  }
+
+  /* Leaf 1, ECX: POPCNT (bit 23), OSXSAVE (bit 27), AVX (bit 28) */
+  mld_sys_cpuid(1, 0, regs);
+  if ((regs[2] & (1u << 23)) == 0 || (regs[2] & (1u << 27)) == 0 ||
+      (regs[2] & (1u << 28)) == 0)
+  {
+    return 0;
+  }
+
+  /* The OS must save and restore the XMM and YMM registers */
+  if ((mld_sys_xgetbv(0) & 0x6) != 0x6)
+  {
+    return 0;
+  }
+
+  /* Leaf 7, EBX: AVX2 (bit 5), BMI2 (bit 8) */
+  mld_sys_cpuid(7, 0, regs);
+  if ((regs[1] & (1u << 5)) != 0 && (regs[1] & (1u << 8)) != 0)
+  {
+    caps |= MLD_SYS_CAP_AVX2;
+  }
+
+  return caps;
+}
+#else  /* MLD_SYS_X86_64 && MLD_HAVE_INLINE_ASM */
+static int mld_sys_detect(void)
+{
+#if defined(MLD_SYS_X86_64_AVX2) && !defined(MLD_SYS_X86_64_AVX2_RUNTIME)
+  /* No way to query the CPU; trust the compiler flags. */
+  return MLD_SYS_CAP_AVX2;
+#else
+  return 0;
+#endif
+}
+#endif /* !(MLD_SYS_X86_64 && MLD_HAVE_INLINE_ASM) */
+
+#if !defined(MLD_CONFIG_NO_CAPS_ENV)
+static int mld_sys_env_mask(void)
+{
+  const char *env = getenv("MLD_DISABLE_CAPS");
+  if (env == NULL)
+  {
+    return 0;
+  }
+  if (strcmp(env, "all") == 0)
+  {
+    return -1;
+  }
+  return strstr(env, "avx2") != NULL ? MLD_SYS_CAP_AVX2 : 0;
+}
+#endif /* !MLD_CONFIG_NO_CAPS_ENV */
+
+void mld_init(void)
+{
+  int caps = mld_sys_detect();
+#if !defined(MLD_CONFIG_NO_CAPS_ENV)
+  caps &= ~mld_sys_env_mask();
+#endif
+  /* Computed in full before publishing, so that concurrent first-use
+   * initializations store identical values. */
+  mld_sys_caps_store(caps);
+}
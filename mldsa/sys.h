@@ -22,7 +22,16 @@
 #define MLD_SYS_X86_64
 #if defined(__AVX2__)
 #define MLD_SYS_X86_64_AVX2
-#endif
+#elif !defined(MLD_CONFIG_NO_RUNTIME_DISPATCH) && \
+    (defined(__GNUC__) || defined(__clang__))
+/* The compiler was not told to assume AVX2, but it can still emit AVX2
+ * code for individual functions. Build the AVX2 backends with per-function
+ * target attributes and only call them if the CPU supports AVX2, as
+ * determined at runtime by mld_sys_check_capability(). */
+#define MLD_SYS_X86_64_AVX2
+#define MLD_SYS_X86_64_AVX2_RUNTIME
+#endif /* !__AVX2__ && !MLD_CONFIG_NO_RUNTIME_DISPATCH && (__GNUC__ || \
+          __clang__) */
 #endif /* __x86_64__ */
 
 #if defined(_WIN32)
@@ -164,10 +173,136 @@
   } while (0)
 #endif /* !(MLD_CONFIG_CT_TESTING_ENABLED && !__ASSEMBLER__) */
 
+/* Thread-local storage, if the compiler supports it */
+#if defined(__GNUC__) || defined(__clang__)
+#define MLD_THREAD_LOCAL __thread
+#elif defined(_MSC_VER)
+#define MLD_THREAD_LOCAL __declspec(thread)
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define MLD_THREAD_LOCAL _Thread_local
+#endif
+
 #if defined(__GNUC__) || defined(clang)
 #define MLD_MUST_CHECK_RETURN_VALUE __attribute__((warn_unused_result))
 #else
 #define MLD_MUST_CHECK_RETURN_VALUE
 #endif
 
+/*
+ * Function attribute enabling the instruction set extensions used by the
+ * x86_64 AVX2 backends. Empty if the compiler already assumes them
+ * globally.
+ */
+#if defined(MLD_SYS_X86_64_AVX2_RUNTIME)
+#define MLD_TARGET_AVX2 __attribute__((target("avx2,bmi2,popcnt")))
+#else
+#define MLD_TARGET_AVX2
+#endif
+
+/*
+ * Return values of native backend functions
+ *
+ * A native function returns MLD_NATIVE_FUNC_FALLBACK if it cannot handle
+ * the given input, or if the CPU lacks the instructions it relies on. The
+ * caller then falls back to the C implementation.
+ */
+#define MLD_NATIVE_FUNC_SUCCESS (0)
+#define MLD_NATIVE_FUNC_FALLBACK (-1)
+
+#if !defined(__ASSEMBLER__)
+#include <stddef.h>
+#include <string.h>
+
+/*
+ * Runtime CPU capabilities
+ *
+ * Native backends check for the capabilities they need before each call.
+ * Detection happens once, either on first use or through an explicit call
+ * to mld_init(). The state is shared by all parameter sets and the FIPS202
+ * module, so it is namespaced independently of MLDSA_MODE.
+ *
+ * Only AVX2 is detected, as it is the only x86_64 extension with native
+ * backends; CPUs with AVX-512 use the AVX2 backends.
+ */
+typedef enum
+{
+  MLD_SYS_CAP_AVX2 = 1
+} mld_sys_cap;
+
+#define MLD_SYS_NAMESPACE(s) mldsa_sys_##s
+
+#define mld_sys_caps MLD_SYS_NAMESPACE(caps)
+extern int mld_sys_caps;
+
+/*
+ * Accesses to mld_sys_caps. Threads using the library concurrently may all
+ * detect the capabilities on first use; they store the same value, so
+ * relaxed atomics suffice. Without the GCC atomic builtins, the accesses
+ * are plain, and mld_init() must be called before starting threads.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define mld_sys_caps_load() __atomic_load_n(&mld_sys_caps, __ATOMIC_RELAXED)
+#define mld_sys_caps_store(caps) \
+  __atomic_store_n(&mld_sys_caps, (caps), __ATOMIC_RELAXED)
+#else
+#define mld_sys_caps_load() (mld_sys_caps)
+#define mld_sys_caps_store(caps) (mld_sys_caps = (caps))
+#endif
+
+#define mld_init MLD_SYS_NAMESPACE(init)
+/*************************************************
+ * Name:        mld_init
+ *
+ * Description: Detects the capabilities of the CPU and selects the native
+ *              backends to use. Calling this is optional: capabilities are
+ *              otherwise detected on first use, which is thread-safe with
+ *              GCC and clang. With other compilers, multi-threaded
+ *              programs must call it once before starting threads.
+ *
+ *              Unless MLD_CONFIG_NO_CAPS_ENV is set, the environment
+ *              variable MLD_DISABLE_CAPS can be used to disable
+ *              capabilities which the CPU supports, e.g. to test the C
+ *              fallbacks. It takes a comma-separated list of capability
+ *              names ("avx2"), or "all".
+ **************************************************/
+void mld_init(void);
+
+static MLD_INLINE int mld_sys_check_capability(mld_sys_cap cap)
+{
+  int caps = mld_sys_caps_load();
+  if (caps < 0)
+  {
+    mld_init();
+    caps = mld_sys_caps_load();
+  }
+  return (caps & (int)cap) != 0;
+}
+
+/*************************************************
+ * Name:        mld_zeroize
+ *
+ * Description: Clears len bytes at ptr holding secret data. Unlike a
+ *              plain memset, the compiler must not remove the clearing
+ *              even if the memory is dead afterwards, also after inlining
+ *              or with link-time optimization: with inline assembly, an
+ *              empty asm statement taking ptr and clobbering memory makes
+ *              the zeroed bytes appear to be read; otherwise, memset is
+ *              called through a volatile function pointer, whose target
+ *              the compiler cannot know.
+ **************************************************/
+#if defined(MLD_HAVE_INLINE_ASM)
+static MLD_INLINE void mld_zeroize(void *ptr, size_t len)
+{
+  memset(ptr, 0, len);
+  __asm__ __volatile__("" : : "r"(ptr) : "memory");
+}
+#else  /* MLD_HAVE_INLINE_ASM */
+static MLD_INLINE void mld_zeroize(void *ptr, size_t len)
+{
+  static void *(*const volatile memset_v)(void *, int, size_t) = memset;
+  memset_v(ptr, 0, len);
+}
+#endif /* !MLD_HAVE_INLINE_ASM */
+#endif /* !__ASSEMBLER__ */
+
 #endif /* !MLD_SYS_H */
@@ -3,43 +3,159 @@
  * Copyright (c) 2024-2025 The mlkem-native project authors
  * SPDX-License-Identifier: Apache-2.0
  */
+
+/*
+ * Benchmarks of the individual building blocks of ML-DSA.
+ *
+ * Usage: bench_components_mldsaXX [name ...]
+ *
+ * Without arguments, all benchmarks are run. Otherwise, only the benchmarks
+ * whose name starts with one of the arguments are run, e.g. `shake256` runs
+ * all SHAKE256 input sizes and `polyz_` the packing of z.
+ */
 #include <inttypes.h>
 #include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include "../mldsa/fips202/fips202.h"
+#include "../mldsa/fips202/keccakf1600.h"
 #include "../mldsa/ntt.h"
+#include "../mldsa/packing.h"
+#include "../mldsa/poly.h"
+#include "../mldsa/polyvec.h"
 #include "../mldsa/randombytes.h"
+#include "../mldsa/sign.h"
 #include "hal.h"
 
 #define NWARMUP 50
 #define NITERATIONS 300
 #define NTESTS 20
 
+#define SHAKE_MAXINBYTES 16384
+#define SHAKE_OUTBYTES 64
+
 static int cmp_uint64_t(const void *a, const void *b)
 {
   return (int)((*((const uint64_t *)a)) - (*((const uint64_t *)b)));
 }
 
-#define BENCH(txt, code)                                \
-  for (i = 0; i < NTESTS; i++)                          \
-  {                                                     \
-    randombytes((uint8_t *)data0, sizeof(data0));       \
-    for (j = 0; j < NWARMUP; j++)                       \
-    {                                                   \
-      code;                                             \
-    }                                                   \
-                                                        \
-    t0 = get_cyclecounter();                            \
-    for (j = 0; j < NITERATIONS; j++)                   \
-    {                                                   \
-      code;                                             \
-    }                                                   \
-    t1 = get_cyclecounter();                            \
-    (cyc)[i] = t1 - t0;                                 \
-  }                                                     \
-  qsort((cyc), NTESTS, sizeof(uint64_t), cmp_uint64_t); \
-  printf(txt " cycles=%" PRIu64 "\n", (cyc)[NTESTS >> 1] / NITERATIONS);
+static int bench_argc;
+static char **bench_argv;
+/* Per command line argument: whether it selected at least one benchmark */
+static int *bench_matched;
+
+static int bench_selected(const char *name)
+{
+  int k, selected = bench_argc <= 1;
+
+  for (k = 1; k < bench_argc; k++)
+  {
+    if (strncmp(name, bench_argv[k], strlen(bench_argv[k])) == 0)
+    {
+      bench_matched[k] = 1;
+      selected = 1;
+    }
+  }
+  return selected;
+}
+
+#define BENCH(txt, code)                                                   \
+  if (bench_selected(txt))                                                 \
+  {                                                                        \
+    for (i = 0; i < NTESTS; i++)                                           \
+    {                                                                      \
+      randombytes((uint8_t *)data0, sizeof(data0));                        \
+      for (j = 0; j < NWARMUP; j++)                                        \
+      {                                                                    \
+        code;                                                              \
+      }                                                                    \
+                                                                           \
+      t0 = get_cyclecounter();                                             \
+      for (j = 0; j < NITERATIONS; j++)                                    \
+      {                                                                    \
+        code;                                                              \
+      }                                                                    \
+      t1 = get_cyclecounter();                                             \
+      (cyc)[i] = t1 - t0;                                                  \
+    }                                                                      \
+    qsort((cyc), NTESTS, sizeof(uint64_t), cmp_uint64_t);                  \
+    printf(txt " cycles=%" PRIu64 "\n", (cyc)[NTESTS >> 1] / NITERATIONS); \
+  }
+
+/* Inputs and outputs of the benchmarked functions. Inputs are taken from a
+ * genuine key pair and signature, so that they have the ranges the
+ * functions see during signing and verification. Kept static because of
+ * their size. */
+static struct
+{
+  uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[CRYPTO_SECRETKEYBYTES];
+  uint8_t sig[CRYPTO_BYTES];
+  uint8_t rho[MLDSA_SEEDBYTES];
+  uint8_t tr[MLDSA_TRBYTES];
+  uint8_t key[MLDSA_SEEDBYTES];
+  uint8_t ctilde[MLDSA_CTILDEBYTES];
+  uint8_t rhoprime[MLDSA_CRHBYTES];
+  uint8_t packed[MLDSA_POLYT0_PACKEDBYTES];
+  uint8_t shake_in[SHAKE_MAXINBYTES];
+  uint8_t shake_out[SHAKE_OUTBYTES];
+  uint64_t keccak[25];
+  polyvecl s1, z, y;
+  polyveck s2, t0, t1, h, w, w0, w1, v;
+  poly a, r, c, chat;
+  poly_challenge_sparse csparse;
+  unsigned int nhints;
+} d;
+
+static int bench_setup(void)
+{
+  size_t siglen;
+  unsigned int k, n;
+  const uint8_t m[1] = {0};
+
+  if (crypto_sign_keypair(d.pk, d.sk) != 0 ||
+      crypto_sign_signature(d.sig, &siglen, m, sizeof(m), NULL, 0, d.sk) !=
+          0)
+  {
+    return 1;
+  }
+
+  unpack_pk(d.rho, &d.t1, d.pk);
+  unpack_sk(d.rho, d.tr, d.key, &d.t0, &d.s1, &d.s2, d.sk);
+  if (unpack_sig(d.ctilde, &d.z, &d.h, d.sig) != 0)
+  {
+    return 1;
+  }
+
+  randombytes(d.rhoprime, sizeof(d.rhoprime));
+  randombytes(d.shake_in, sizeof(d.shake_in));
+  polyvecl_uniform_gamma1(&d.y, d.rhoprime, 0);
+  polyvecl_ntt(&d.y);
+
+  /* w = A*y is uniform modulo q */
+  for (k = 0; k < MLDSA_K; k++)
+  {
+    poly_uniform(&d.w.vec[k], d.rho, (uint16_t)k);
+  }
+  polyveck_decompose(&d.w1, &d.w0, &d.w);
+
+  d.nhints = 0;
+  for (k = 0; k < MLDSA_K; k++)
+  {
+    for (n = 0; n < MLDSA_N; n++)
+    {
+      d.nhints += (unsigned int)d.h.vec[k].coeffs[n];
+    }
+  }
+
+  poly_challenge(&d.c, d.ctilde);
+  d.chat = d.c;
+  poly_ntt(&d.chat);
+  poly_challenge_to_sparse(&d.csparse, &d.c);
+  d.a = d.s1.vec[0];
+  return 0;
+}
 
 static int bench(void)
 {
@@ -48,17 +164,93 @@ static int bench(void)
   unsigned i, j;
   uint64_t t0, t1;
 
-  /* ntt */
+  /* Arithmetic */
   BENCH("ntt", ntt(data0))
+  BENCH("invntt_tomont", invntt_tomont(data0))
+  BENCH("poly_pointwise_montgomery",
+        poly_pointwise_montgomery(&d.r, &d.chat, &d.y.vec[0]))
+  BENCH("polyvecl_pointwise_acc_montgomery",
+        polyvecl_pointwise_acc_montgomery(&d.r, &d.y, &d.y))
+
+  /* Multiplication of a short secret polynomial by the challenge, as done
+   * K + L times per signing attempt: pointwise product with the NTT of the
+   * secret followed by an inverse NTT, or sparse multiplication. */
+  BENCH("challenge_mul_ntt", poly_pointwise_montgomery(&d.r, &d.chat, &d.a);
+        poly_invntt_tomont(&d.r))
+  BENCH("challenge_mul_sparse", poly_sparse_mul(&d.r, &d.csparse, &d.a))
+
+  /* Sampling */
+  BENCH("poly_uniform", poly_uniform(&d.r, d.rho, 0))
+  BENCH("poly_uniform_eta", poly_uniform_eta(&d.r, d.rhoprime, 0))
+  BENCH("poly_uniform_gamma1", poly_uniform_gamma1(&d.r, d.rhoprime, 0))
+  BENCH("poly_challenge", poly_challenge(&d.r, d.ctilde))
+
+  /* Polynomial packing */
+  BENCH("polyeta_pack", polyeta_pack(d.packed, &d.s1.vec[0]))
+  BENCH("polyeta_unpack", polyeta_unpack(&d.r, d.packed))
+  BENCH("polyt1_pack", polyt1_pack(d.packed, &d.t1.vec[0]))
+  BENCH("polyt1_unpack", polyt1_unpack(&d.r, d.packed))
+  BENCH("polyt0_pack", polyt0_pack(d.packed, &d.t0.vec[0]))
+  BENCH("polyt0_unpack", polyt0_unpack(&d.r, d.packed))
+  BENCH("polyz_pack", polyz_pack(d.packed, &d.z.vec[0]))
+  BENCH("polyz_unpack", polyz_unpack(&d.r, d.packed))
+  BENCH("polyw1_pack", polyw1_pack(d.packed, &d.w1.vec[0]))
+
+  /* Key and signature packing */
+  BENCH("pack_pk", pack_pk(d.pk, d.rho, &d.t1))
+  BENCH("unpack_pk", unpack_pk(d.rho, &d.t1, d.pk))
+  BENCH("pack_sk", pack_sk(d.sk, d.rho, d.tr, d.key, &d.t0, &d.s1, &d.s2))
+  BENCH("unpack_sk", unpack_sk(d.rho, d.tr, d.key, &d.t0, &d.s1, &d.s2, d.sk))
+  BENCH("pack_sig", pack_sig(d.sig, d.ctilde, &d.z, &d.h, d.nhints))
+  BENCH("unpack_sig", unpack_sig(d.ctilde, &d.z, &d.h, d.sig))
+
+  /* Rounding */
+  BENCH("polyveck_decompose", polyveck_decompose(&d.w1, &d.w0, &d.w))
+  BENCH("polyveck_make_hint", polyveck_make_hint(&d.v, &d.w0, &d.w1))
+  BENCH("polyveck_use_hint", polyveck_use_hint(&d.v, &d.w, &d.h))
+
+  /* FIPS 202 */
+  BENCH("keccakf1600", KeccakF1600_StatePermute(d.keccak))
+  BENCH("shake128_32", shake128(d.shake_out, SHAKE_OUTBYTES, d.shake_in, 32))
+  BENCH("shake128_1024",
+        shake128(d.shake_out, SHAKE_OUTBYTES, d.shake_in, 1024))
+  BENCH("shake128_16384",
+        shake128(d.shake_out, SHAKE_OUTBYTES, d.shake_in, 16384))
+  BENCH("shake256_32", shake256(d.shake_out, SHAKE_OUTBYTES, d.shake_in, 32))
+  BENCH("shake256_1024",
+        shake256(d.shake_out, SHAKE_OUTBYTES, d.shake_in, 1024))
+  BENCH("shake256_16384",
+        shake256(d.shake_out, SHAKE_OUTBYTES, d.shake_in, 16384))
 
   return 0;
 }
 
-int main(void)
+int main(int argc, char *argv[])
 {
+  int k, r = 0;
+
+  bench_argc = argc;
+  bench_argv = argv;
+  bench_matched = calloc((size_t)argc, sizeof(int));
+  if (bench_matched == NULL || bench_setup() != 0)
+  {
+    fprintf(stderr, "ERROR: benchmark setup failed\n");
+    return 1;
+  }
+
   enable_cyclecounter();
   bench();
   disable_cyclecounter();
 
-  return 0;
+  for (k = 1; k < argc; k++)
+  {
+    if (!bench_matched[k])
+    {
+      fprintf(stderr, "ERROR: no benchmark matches '%s'\n", argv[k]);
+      r = 1;
+    }
+  }
+
+  free(bench_matched);
+  return r;
 }
@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include "../mldsa/fips202/fips202.h"
 #include "../mldsa/randombytes.h"
 #include "../mldsa/sign.h"
 #include "hal.h"
@@ -17,6 +18,11 @@
 #define NTESTS 250
 #define MLEN 59
 #define CTXLEN 1
+#define NTESTS_BATCH 25
+#define MAX_BATCH 256
+#define NTESTS_SWEEP 15
+#define SWEEP_MAXMLEN (16 * 1024 * 1024)
+#define SWEEP_MAXCTXLEN 255
 
 #define CHECK(x)                                              \
   do                                                          \
@@ -30,23 +36,96 @@
     }                                                         \
   } while (0)
 
+#if MLDSA_MODE == 2
+#define SCHEME "ML-DSA-44"
+#elif MLDSA_MODE == 3
+#define SCHEME "ML-DSA-65"
+#elif MLDSA_MODE == 5
+#define SCHEME "ML-DSA-87"
+#endif
+
+/* Output format, selected with --format=text|json|csv */
+typedef enum
+{
+  FORMAT_TEXT,
+  FORMAT_JSON,
+  FORMAT_CSV
+} bench_format;
+
+static bench_format format = FORMAT_TEXT;
+/* Events counted by the cycle counter backend, see get_counters() */
+static unsigned events;
+/* Number of records printed so far, to separate JSON objects */
+static unsigned nrecords;
+
+/* Counts of all events for each of the NTESTS tests */
+typedef uint64_t bench_counters[HAL_NUM_EVENTS][NTESTS];
+
 static int cmp_uint64_t(const void *a, const void *b)
 {
   return (int)((*((const uint64_t *)a)) - (*((const uint64_t *)b)));
 }
 
-static void print_median(const char *txt, uint64_t cyc[NTESTS])
+static void record_counters(bench_counters c, unsigned i,
+                            const uint64_t start[HAL_NUM_EVENTS],
+                            const uint64_t end[HAL_NUM_EVENTS])
+{
+  unsigned k;
+  for (k = 0; k < HAL_NUM_EVENTS; k++)
+  {
+    c[k][i] = end[k] - start[k];
+  }
+}
+
+/* Sorts the counts of each event independently */
+static void sort_counters(bench_counters c)
+{
+  unsigned k;
+  for (k = 0; k < HAL_NUM_EVENTS; k++)
+  {
+    qsort(c[k], NTESTS, sizeof(uint64_t), cmp_uint64_t);
+  }
+}
+
+static int has_event(unsigned event) { return (events >> event) & 1; }
+
+static double ipc(uint64_t cycles, uint64_t instructions)
 {
-  printf("%10s cycles = %" PRIu64 "\n", txt, cyc[NTESTS >> 1] / NITERATIONS);
+  return cycles == 0 ? 0.0 : (double)instructions / (double)cycles;
+}
+
+static void print_median(const char *txt, bench_counters c)
+{
+  uint64_t cyc = c[HAL_EVENT_CYCLES][NTESTS >> 1];
+  uint64_t ins = c[HAL_EVENT_INSTRUCTIONS][NTESTS >> 1];
+
+  printf("%10s cycles = %" PRIu64, txt, cyc / NITERATIONS);
+  if (has_event(HAL_EVENT_INSTRUCTIONS))
+  {
+    printf(", instructions = %" PRIu64 " (ipc %.2f)", ins / NITERATIONS,
+           ipc(cyc, ins));
+  }
+  if (has_event(HAL_EVENT_L1D_MISSES))
+  {
+    printf(", l1d misses = %" PRIu64,
+           c[HAL_EVENT_L1D_MISSES][NTESTS >> 1] / NITERATIONS);
+  }
+  if (has_event(HAL_EVENT_BRANCH_MISSES))
+  {
+    printf(", branch misses = %" PRIu64,
+           c[HAL_EVENT_BRANCH_MISSES][NTESTS >> 1] / NITERATIONS);
+  }
+  printf("\n");
 }
 
 static int percentiles[] = {1, 10, 20, 30, 40, 50, 60, 70, 80, 90, 99};
+#define NPERCENTILES (sizeof(percentiles) / sizeof(percentiles[0]))
 
 static void print_percentile_legend(void)
 {
   unsigned i;
   printf("%21s", "percentile");
-  for (i = 0; i < sizeof(percentiles) / sizeof(percentiles[0]); i++)
+  for (i = 0; i < NPERCENTILES; i++)
   {
     printf("%7d", percentiles[i]);
   }
@@ -57,13 +136,139 @@ static void print_percentiles(const char *txt, uint64_t cyc[NTESTS])
 {
   unsigned i;
   printf("%10s percentiles:", txt);
-  for (i = 0; i < sizeof(percentiles) / sizeof(percentiles[0]); i++)
+  for (i = 0; i < NPERCENTILES; i++)
   {
     printf("%7" PRIu64, (cyc)[NTESTS * percentiles[i] / 100] / NITERATIONS);
   }
   printf("\n");
 }
 
+static void print_header(void)
+{
+  unsigned i;
+
+  if (format == FORMAT_JSON)
+  {
+    printf("{\n  \"scheme\": \"%s\",\n  \"results\": [", SCHEME);
+  }
+  else if (format == FORMAT_CSV)
+  {
+    printf("scheme,name,batch_size,cycles,instructions,ipc,l1d_misses,"
+           "branch_misses");
+    for (i = 0; i < NPERCENTILES; i++)
+    {
+      printf(",p%d", percentiles[i]);
+    }
+    printf("\n");
+  }
+}
+
+static void print_footer(void)
+{
+  if (format == FORMAT_JSON)
+  {
+    printf("\n  ]\n}\n");
+  }
+}
+
+/*
+ * Prints one result in JSON or CSV format.
+ *
+ * c holds the sorted counts of NTESTS tests of `ops` operations each. If c
+ * is NULL, only the number of cycles per operation is known and passed in
+ * `cycles`. batch_size is 0 for operations on a single signature.
+ */
+static void print_record(const char *name, unsigned batch_size,
+                         bench_counters c, uint64_t cycles, unsigned ops)
+{
+  static const char *const event_names[HAL_NUM_EVENTS] = {
+      "cycles", "instructions", "l1d_misses", "branch_misses"};
+  uint64_t median[HAL_NUM_EVENTS] = {0};
+  unsigned k, i;
+
+  median[HAL_EVENT_CYCLES] = cycles;
+  if (c != NULL)
+  {
+    for (k = 0; k < HAL_NUM_EVENTS; k++)
+    {
+      median[k] = c[k][NTESTS >> 1] / ops;
+    }
+  }
+
+  if (format == FORMAT_JSON)
+  {
+    printf("%s\n    {\"name\": \"%s\"", nrecords++ ? "," : "", name);
+    if (batch_size != 0)
+    {
+      printf(", \"batch_size\": %u", batch_size);
+    }
+    for (k = 0; k < HAL_NUM_EVENTS; k++)
+    {
+      if (k == HAL_EVENT_CYCLES || (c != NULL && has_event(k)))
+      {
+        printf(", \"%s\": %" PRIu64, event_names[k], median[k]);
+      }
+    }
+    if (c != NULL && has_event(HAL_EVENT_INSTRUCTIONS))
+    {
+      printf(", \"ipc\": %.3f",
+             ipc(c[HAL_EVENT_CYCLES][NTESTS >> 1],
+                 c[HAL_EVENT_INSTRUCTIONS][NTESTS >> 1]));
+    }
+    if (c != NULL)
+    {
+      printf(", \"percentiles\": {");
+      for (i = 0; i < NPERCENTILES; i++)
+      {
+        printf("%s\"%d\": %" PRIu64, i ? ", " : "", percentiles[i],
+               c[HAL_EVENT_CYCLES][NTESTS * percentiles[i] / 100] / ops);
+      }
+      printf("}");
+    }
+    printf("}");
+  }
+  else if (format == FORMAT_CSV)
+  {
+    printf("%s,%s,%u,%" PRIu64, SCHEME, name, batch_size, median[0]);
+    for (k = 1; k < HAL_NUM_EVENTS; k++)
+    {
+      if (c != NULL && has_event(k))
+      {
+        printf(",%" PRIu64, median[k]);
+      }
+      else
+      {
+        printf(",");
+      }
+      if (k == HAL_EVENT_INSTRUCTIONS)
+      {
+        if (c != NULL && has_event(k))
+        {
+          printf(",%.3f", ipc(c[HAL_EVENT_CYCLES][NTESTS >> 1],
+                              c[HAL_EVENT_INSTRUCTIONS][NTESTS >> 1]));
+        }
+        else
+        {
+          printf(",");
+        }
+      }
+    }
+    for (i = 0; i < NPERCENTILES; i++)
+    {
+      if (c != NULL)
+      {
+        printf(",%" PRIu64,
+               c[HAL_EVENT_CYCLES][NTESTS * percentiles[i] / 100] / ops);
+      }
+      else
+      {
+        printf(",");
+      }
+    }
+    printf("\n");
+  }
+}
+
 static int bench(void)
 {
   uint8_t pk[CRYPTO_PUBLICKEYBYTES];
@@ -75,9 +280,10 @@ static int bench(void)
   size_t siglen;
 
   unsigned i, j;
-  uint64_t t0, t1;
+  uint64_t t0[HAL_NUM_EVENTS], t1[HAL_NUM_EVENTS];
 
-  uint64_t cycles_kg[NTESTS], cycles_sign[NTESTS], cycles_verify[NTESTS];
+  /* Static because of their size */
+  static bench_counters counters_kg, counters_sign, counters_verify;
   unsigned char pre[CTXLEN + 2];
 
   for (i = 0; i < NTESTS; i++)
@@ -93,13 +299,13 @@ static int bench(void)
       ret |= crypto_sign_keypair_internal(pk, sk, kg_rand);
     }
 
-    t0 = get_cyclecounter();
+    get_counters(t0);
     for (j = 0; j < NITERATIONS; j++)
     {
       ret |= crypto_sign_keypair_internal(pk, sk, kg_rand);
     }
-    t1 = get_cyclecounter();
-    cycles_kg[i] = t1 - t0;
+    get_counters(t1);
+    record_counters(counters_kg, i, t0, t1);
 
 
     /* Signing */
@@ -117,55 +323,423 @@ static int bench(void)
       ret |= crypto_sign_signature_internal(sig, &siglen, m, MLEN, pre,
                                             CTXLEN + 2, sig_rand, sk, 0);
     }
-    t0 = get_cyclecounter();
+    get_counters(t0);
     for (j = 0; j < NITERATIONS; j++)
     {
       ret |= crypto_sign_signature_internal(sig, &siglen, m, MLEN, pre,
                                             CTXLEN + 2, sig_rand, sk, 0);
     }
-    t1 = get_cyclecounter();
-    cycles_sign[i] = t1 - t0;
+    get_counters(t1);
+    record_counters(counters_sign, i, t0, t1);
 
     /* Verification */
     for (j = 0; j < NWARMUP; j++)
     {
       ret |= crypto_sign_verify(sig, siglen, m, MLEN, ctx, CTXLEN, pk);
     }
-    t0 = get_cyclecounter();
+    get_counters(t0);
     for (j = 0; j < NITERATIONS; j++)
     {
       ret |= crypto_sign_verify(sig, siglen, m, MLEN, ctx, CTXLEN, pk);
     }
-    t1 = get_cyclecounter();
-    cycles_verify[i] = t1 - t0;
+    get_counters(t1);
+    record_counters(counters_verify, i, t0, t1);
 
     CHECK(ret == 0);
   }
 
-  qsort(cycles_kg, NTESTS, sizeof(uint64_t), cmp_uint64_t);
-  qsort(cycles_sign, NTESTS, sizeof(uint64_t), cmp_uint64_t);
-  qsort(cycles_verify, NTESTS, sizeof(uint64_t), cmp_uint64_t);
+  sort_counters(counters_kg);
+  sort_counters(counters_sign);
+  sort_counters(counters_verify);
 
-  print_median("keypair", cycles_kg);
-  print_median("sign", cycles_sign);
-  print_median("verify", cycles_verify);
+  if (format != FORMAT_TEXT)
+  {
+    print_record("keypair", 0, counters_kg, 0, NITERATIONS);
+    print_record("sign", 0, counters_sign, 0, NITERATIONS);
+    print_record("verify", 0, counters_verify, 0, NITERATIONS);
+    return 0;
+  }
+
+  print_median("keypair", counters_kg);
+  print_median("sign", counters_sign);
+  print_median("verify", counters_verify);
 
   printf("\n");
 
   print_percentile_legend();
 
-  print_percentiles("keypair", cycles_kg);
-  print_percentiles("sign", cycles_sign);
-  print_percentiles("verify", cycles_verify);
+  print_percentiles("keypair", counters_kg[HAL_EVENT_CYCLES]);
+  print_percentiles("sign", counters_sign[HAL_EVENT_CYCLES]);
+  print_percentiles("verify", counters_verify[HAL_EVENT_CYCLES]);
+
+  return 0;
+}
+
+static int bench_verify_batch(void)
+{
+  uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[CRYPTO_SECRETKEYBYTES];
+  uint8_t ctx[CTXLEN];
+  uint8_t *sig, *m;
+  const uint8_t *sigs[MAX_BATCH];
+  const uint8_t *ms[MAX_BATCH];
+  size_t siglens[MAX_BATCH];
+  size_t mlens[MAX_BATCH];
+  int results[MAX_BATCH];
+  unsigned i, j, n;
+  int ret = 0;
+  uint64_t t0, t1;
+  uint64_t cycles_single[NTESTS_BATCH], cycles_batch[NTESTS_BATCH];
+
+  sig = malloc(MAX_BATCH * CRYPTO_BYTES);
+  m = malloc(MAX_BATCH * MLEN);
+  if (sig == NULL || m == NULL)
+  {
+    free(sig);
+    free(m);
+    fprintf(stderr, "ERROR (%s,%d)\n", __FILE__, __LINE__);
+    return 1;
+  }
+
+  crypto_sign_keypair(pk, sk);
+  randombytes(ctx, CTXLEN);
+  for (i = 0; i < MAX_BATCH; i++)
+  {
+    randombytes(m + i * MLEN, MLEN);
+    ret |= crypto_sign_signature(sig + i * CRYPTO_BYTES, &siglens[i],
+                                 m + i * MLEN, MLEN, ctx, CTXLEN, sk);
+    sigs[i] = sig + i * CRYPTO_BYTES;
+    ms[i] = m + i * MLEN;
+    mlens[i] = MLEN;
+  }
+
+  if (format == FORMAT_TEXT)
+  {
+    printf("\n%12s %16s %16s\n", "batch size", "verify/sig", "batch/sig");
+  }
+  for (n = 1; n <= MAX_BATCH; n *= 2)
+  {
+    for (i = 0; i < NTESTS_BATCH; i++)
+    {
+      /* Verification, one signature at a time */
+      t0 = get_cyclecounter();
+      for (j = 0; j < n; j++)
+      {
+        ret |= crypto_sign_verify(sigs[j], siglens[j], ms[j], mlens[j], ctx,
+                                  CTXLEN, pk);
+      }
+      t1 = get_cyclecounter();
+      cycles_single[i] = t1 - t0;
+
+      /* Batch verification */
+      t0 = get_cyclecounter();
+      ret |= crypto_sign_verify_batch(sigs, siglens, ms, mlens, n, ctx, CTXLEN,
+                                      pk, results);
+      t1 = get_cyclecounter();
+      cycles_batch[i] = t1 - t0;
+    }
+
+    qsort(cycles_single, NTESTS_BATCH, sizeof(uint64_t), cmp_uint64_t);
+    qsort(cycles_batch, NTESTS_BATCH, sizeof(uint64_t), cmp_uint64_t);
+
+    if (format == FORMAT_TEXT)
+    {
+      printf("%12u %16" PRIu64 " %16" PRIu64 "\n", n,
+             cycles_single[NTESTS_BATCH >> 1] / n,
+             cycles_batch[NTESTS_BATCH >> 1] / n);
+    }
+    else
+    {
+      print_record("verify", n, NULL, cycles_single[NTESTS_BATCH >> 1] / n, 1);
+      print_record("verify_batch", n, NULL,
+                   cycles_batch[NTESTS_BATCH >> 1] / n, 1);
+    }
+  }
 
+  free(sig);
+  free(m);
+  CHECK(ret == 0);
   return 0;
 }
 
-int main(void)
+/* Message and context lengths of the --sweep mode */
+static const size_t sweep_mlens[] = {0,      64,      256,     1024,
+                                     4096,   16384,   65536,   262144,
+                                     1048576, 4194304, SWEEP_MAXMLEN};
+static const size_t sweep_ctxlens[] = {0, 1, 16, 64, 128, SWEEP_MAXCTXLEN};
+
+/*
+ * The message-dependent hashing of signing and verification: the
+ * computation of mu = H(tr || 0 || ctxlen || ctx || m), FIPS 204
+ * Algorithm 7, line 6, and Algorithm 8, line 7.
+ */
+static void compute_mu(uint8_t mu[MLDSA_CRHBYTES],
+                       const uint8_t tr[MLDSA_TRBYTES], const uint8_t *m,
+                       size_t mlen, const uint8_t *ctx, size_t ctxlen)
 {
+  keccak_state state;
+  uint8_t pre[2];
+
+  pre[0] = 0;
+  pre[1] = (uint8_t)ctxlen;
+  shake256_init(&state);
+  shake256_absorb(&state, tr, MLDSA_TRBYTES);
+  shake256_absorb(&state, pre, sizeof(pre));
+  shake256_absorb(&state, ctx, ctxlen);
+  shake256_absorb(&state, m, mlen);
+  shake256_finalize(&state);
+  shake256_squeeze(mu, MLDSA_CRHBYTES, &state);
+}
+
+/* Median cycles of sign, verify and the computation of mu, in this order */
+static int bench_sweep_point(uint64_t median[3], const uint8_t *pk,
+                             const uint8_t *sk, const uint8_t *m, size_t mlen,
+                             const uint8_t *ctx, size_t ctxlen)
+{
+  uint8_t sig[CRYPTO_BYTES];
+  uint8_t mu[MLDSA_CRHBYTES];
+  /* tr is stored in the secret key after rho and key */
+  const uint8_t *tr = sk + 2 * MLDSA_SEEDBYTES;
+  uint64_t cyc[3][NTESTS_SWEEP];
+  uint64_t t0, t1;
+  /* Long messages are hashed once per test, short ones repeatedly */
+  unsigned niterations = mlen >= 65536 ? 1 : NITERATIONS;
+  unsigned i, j, k;
+  size_t siglen;
+  int ret = 0;
+
+  for (i = 0; i < NTESTS_SWEEP; i++)
+  {
+    /* Signing draws fresh randomness on every call, so that the median is
+     * taken over different numbers of rejections. */
+    t0 = get_cyclecounter();
+    for (j = 0; j < niterations; j++)
+    {
+      ret |= crypto_sign_signature(sig, &siglen, m, mlen, ctx, ctxlen, sk);
+    }
+    t1 = get_cyclecounter();
+    cyc[0][i] = (t1 - t0) / niterations;
+
+    t0 = get_cyclecounter();
+    for (j = 0; j < niterations; j++)
+    {
+      ret |= crypto_sign_verify(sig, siglen, m, mlen, ctx, ctxlen, pk);
+    }
+    t1 = get_cyclecounter();
+    cyc[1][i] = (t1 - t0) / niterations;
+
+    t0 = get_cyclecounter();
+    for (j = 0; j < niterations; j++)
+    {
+      compute_mu(mu, tr, m, mlen, ctx, ctxlen);
+    }
+    t1 = get_cyclecounter();
+    cyc[2][i] = (t1 - t0) / niterations;
+  }
+
+  for (k = 0; k < 3; k++)
+  {
+    qsort(cyc[k], NTESTS_SWEEP, sizeof(uint64_t), cmp_uint64_t);
+    median[k] = cyc[k][NTESTS_SWEEP >> 1];
+  }
+
+  CHECK(ret == 0);
+  return 0;
+}
+
+static void print_sweep_legend(const char *len)
+{
+  printf("\n%10s %12s %12s %12s %10s %12s %12s\n", len, "sign", "verify",
+         "mu", "mu/byte", "sign-mu", "verify-mu");
+}
+
+/* mu/byte is the marginal cost: the cycles of mu beyond those for an empty
+ * input (base), per byte of input. */
+static void print_sweep_point(size_t len, const uint64_t median[3],
+                              uint64_t base)
+{
+  printf("%10zu %12" PRIu64 " %12" PRIu64 " %12" PRIu64, len, median[0],
+         median[1], median[2]);
+  if (len == 0)
+  {
+    printf(" %10s", "-");
+  }
+  else
+  {
+    printf(" %10.2f",
+           median[2] < base ? 0.0 : (double)(median[2] - base) / (double)len);
+  }
+  printf(" %12" PRId64 " %12" PRId64 "\n",
+         (int64_t)(median[0] - median[2]), (int64_t)(median[1] - median[2]));
+}
+
+/*
+ * Sign and verify over message lengths from 0 to SWEEP_MAXMLEN bytes (with
+ * an empty context) and context lengths from 0 to 255 (with a message of
+ * MLEN bytes). The cost of hashing the message into mu is reported
+ * separately from the remaining, mostly fixed, lattice cost.
+ */
+static int bench_sweep(void)
+{
+  uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[CRYPTO_SECRETKEYBYTES];
+  uint8_t ctx[SWEEP_MAXCTXLEN];
+  uint8_t *m;
+  uint64_t median[3], base = 0;
+  unsigned i;
+  int ret = 0;
+
+  m = malloc(SWEEP_MAXMLEN);
+  if (m == NULL)
+  {
+    fprintf(stderr, "ERROR (%s,%d)\n", __FILE__, __LINE__);
+    return 1;
+  }
+  randombytes(m, SWEEP_MAXMLEN);
+  randombytes(ctx, sizeof(ctx));
+  ret |= crypto_sign_keypair(pk, sk);
+
+  printf("%s, median cycles per call", SCHEME);
+  print_sweep_legend("mlen");
+  for (i = 0; i < sizeof(sweep_mlens) / sizeof(sweep_mlens[0]); i++)
+  {
+    ret |= bench_sweep_point(median, pk, sk, m, sweep_mlens[i], ctx, 0);
+    if (sweep_mlens[i] == 0)
+    {
+      base = median[2];
+    }
+    print_sweep_point(sweep_mlens[i], median, base);
+  }
+
+  print_sweep_legend("ctxlen");
+  for (i = 0; i < sizeof(sweep_ctxlens) / sizeof(sweep_ctxlens[0]); i++)
+  {
+    ret |= bench_sweep_point(median, pk, sk, m, MLEN, ctx, sweep_ctxlens[i]);
+    if (sweep_ctxlens[i] == 0)
+    {
+      base = median[2];
+    }
+    print_sweep_point(sweep_ctxlens[i], median, base);
+  }
+
+  free(m);
+  CHECK(ret == 0);
+  return 0;
+}
+
+#if defined(MLD_CONFIG_SIGN_STATS)
+#define STATS_NSIGN 10000
+
+/*
+ * Distribution of the number of attempts of the signing rejection loop over
+ * STATS_NSIGN signatures of random messages, and the share of the rejection
+ * conditions among the rejected attempts.
+ */
+static int bench_sign_stats(void)
+{
+  uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[CRYPTO_SECRETKEYBYTES];
+  uint8_t sig[CRYPTO_BYTES];
+  uint8_t m[MLEN];
+  size_t siglen;
+  mld_sign_stats stats;
+  uint64_t rejected;
+  unsigned i;
+  int ret = 0;
+
+  ret |= crypto_sign_keypair(pk, sk);
+  crypto_sign_stats_reset();
+  for (i = 0; i < STATS_NSIGN; i++)
+  {
+    randombytes(m, MLEN);
+    ret |= crypto_sign_signature(sig, &siglen, m, MLEN, NULL, 0, sk);
+  }
+  CHECK(ret == 0);
+  crypto_sign_stats(&stats);
+
+  rejected = stats.reject_z + stats.reject_w0 + stats.reject_ct0 +
+             stats.reject_hints;
+  printf("\n%s, rejection loop over %" PRIu64 " signatures\n", SCHEME,
+         stats.calls);
+  printf("mean attempts: %.3f\n", (double)stats.attempts / stats.calls);
+  for (i = 0; i < MLD_SIGN_STATS_HISTBINS; i++)
+  {
+    if (stats.hist[i] != 0)
+    {
+      printf("%s%2u attempts: %8" PRIu64 " (%5.2f%%)\n",
+             i == MLD_SIGN_STATS_HISTBINS - 1 ? ">=" : "  ", i + 1,
+             stats.hist[i], 100.0 * stats.hist[i] / stats.calls);
+    }
+  }
+  if (rejected != 0)
+  {
+    printf("rejections: z %.1f%%, r0 %.1f%%, ct0 %.1f%%, hints %.1f%%\n",
+           100.0 * stats.reject_z / rejected,
+           100.0 * stats.reject_w0 / rejected,
+           100.0 * stats.reject_ct0 / rejected,
+           100.0 * stats.reject_hints / rejected);
+  }
+  return 0;
+}
+#endif /* MLD_CONFIG_SIGN_STATS */
+
+int main(int argc, char *argv[])
+{
+  uint64_t counters[HAL_NUM_EVENTS];
+  int i, sweep = 0, r = 0;
+
+  for (i = 1; i < argc; i++)
+  {
+    if (strcmp(argv[i], "--format=text") == 0)
+    {
+      format = FORMAT_TEXT;
+    }
+    else if (strcmp(argv[i], "--format=json") == 0)
+    {
+      format = FORMAT_JSON;
+    }
+    else if (strcmp(argv[i], "--format=csv") == 0)
+    {
+      format = FORMAT_CSV;
+    }
+    else if (strcmp(argv[i], "--sweep") == 0)
+    {
+      sweep = 1;
+    }
+    else
+    {
+      fprintf(stderr, "Usage: %s [--format=text|json|csv] | --sweep\n",
+              argv[0]);
+      return 1;
+    }
+  }
+  /* The sweep is reported as text only */
+  if (sweep && format != FORMAT_TEXT)
+  {
+    fprintf(stderr, "--sweep does not support --format\n");
+    return 1;
+  }
+
   enable_cyclecounter();
-  bench();
+  if (sweep)
+  {
+    r = bench_sweep();
+    disable_cyclecounter();
+    return r;
+  }
+
+  events = get_counters(counters);
+  print_header();
+  r |= bench();
+  r |= bench_verify_batch();
+  print_footer();
+#if defined(MLD_CONFIG_SIGN_STATS)
+  if (format == FORMAT_TEXT)
+  {
+    r |= bench_sign_stats();
+  }
+#endif
   disable_cyclecounter();
 
-  return 0;
+  return r;
 }
@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Throughput of key generation, signing and verification with 1 to N
+ * threads, each working on its own keys for a fixed wall-clock duration.
+ *
+ * Usage: bench_throughput_mldsaXX [max_threads [seconds]]
+ *
+ * max_threads defaults to the number of online CPUs and seconds, the
+ * duration of each measurement, to 1. The scaling efficiency is the
+ * aggregate throughput with n threads divided by n times the throughput
+ * with one thread.
+ */
+
+#if defined(__linux__)
+#if !defined(_GNU_SOURCE)
+/* Ensure that clock_gettime() and sysconf() are declared with -std=c99 */
+#define _GNU_SOURCE
+#endif
+#endif /* __linux__ */
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "../mldsa/randombytes.h"
+#include "../mldsa/sign.h"
+
+#define MLEN 59
+#define CTXLEN 1
+
+#if MLDSA_MODE == 2
+#define SCHEME "ML-DSA-44"
+#elif MLDSA_MODE == 3
+#define SCHEME "ML-DSA-65"
+#elif MLDSA_MODE == 5
+#define SCHEME "ML-DSA-87"
+#endif
+
+#define OP_KEYPAIR 0
+#define OP_SIGN 1
+#define OP_VERIFY 2
+#define NOPS 3
+
+static const char *const op_names[NOPS] = {"keypair", "sign", "verify"};
+
+/*
+ * State of one thread. Every thread has its own keys and buffers, allocated
+ * separately. The worker threads do not call randombytes(), which is not
+ * thread-safe in the tests: all randomness is drawn up front and varied by
+ * an iteration counter.
+ */
+typedef struct
+{
+  int op;
+  double duration;
+
+  /* Key pair and signature used for verification */
+  uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[CRYPTO_SECRETKEYBYTES];
+  uint8_t sig[CRYPTO_BYTES];
+  size_t siglen;
+  uint8_t m[MLEN];
+  uint8_t ctx[CTXLEN];
+  uint8_t pre[CTXLEN + 2];
+
+  /* Inputs and outputs of the benchmarked operations */
+  uint8_t seed[MLDSA_SEEDBYTES];
+  uint8_t rnd[MLDSA_RNDBYTES];
+  uint8_t pk_out[CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk_out[CRYPTO_SECRETKEYBYTES];
+  uint8_t sig_out[CRYPTO_BYTES];
+  uint8_t m_sign[MLEN];
+
+  unsigned long ops;
+  double elapsed;
+  int ret;
+} bench_thread;
+
+static double seconds_since(const struct timespec *start)
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (double)(now.tv_sec - start->tv_sec) +
+         (double)(now.tv_nsec - start->tv_nsec) * 1e-9;
+}
+
+static void *bench_worker(void *arg)
+{
+  bench_thread *t = (bench_thread *)arg;
+  struct timespec start;
+  size_t siglen;
+  unsigned long n = 0;
+
+  t->ret = 0;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  do
+  {
+    switch (t->op)
+    {
+      case OP_KEYPAIR:
+        memcpy(t->seed, &n, sizeof(n));
+        t->ret |= crypto_sign_keypair_internal(t->pk_out, t->sk_out, t->seed);
+        break;
+      case OP_SIGN:
+        memcpy(t->m_sign, &n, sizeof(n));
+        t->ret |= crypto_sign_signature_internal(
+            t->sig_out, &siglen, t->m_sign, MLEN, t->pre, CTXLEN + 2, t->rnd,
+            t->sk, 0);
+        break;
+      default:
+        t->ret |= crypto_sign_verify(t->sig, t->siglen, t->m, MLEN, t->ctx,
+                                     CTXLEN, t->pk);
+        break;
+    }
+    n++;
+    t->elapsed = seconds_since(&start);
+  } while (t->elapsed < t->duration);
+
+  t->ops = n;
+  return NULL;
+}
+
+static int bench_setup(bench_thread *t)
+{
+  randombytes(t->seed, sizeof(t->seed));
+  randombytes(t->rnd, sizeof(t->rnd));
+  randombytes(t->m, sizeof(t->m));
+  randombytes(t->ctx, sizeof(t->ctx));
+  memcpy(t->m_sign, t->m, MLEN);
+  t->pre[0] = 0;
+  t->pre[1] = CTXLEN;
+  memcpy(t->pre + 2, t->ctx, CTXLEN);
+
+  return crypto_sign_keypair_internal(t->pk, t->sk, t->seed) |
+         crypto_sign_signature_internal(t->sig, &t->siglen, t->m, MLEN, t->pre,
+                                        CTXLEN + 2, t->rnd, t->sk, 0);
+}
+
+/* Runs op on nthreads threads; *total is set to the aggregate ops/s */
+static int bench_op(bench_thread **threads, pthread_t *tids,
+                    unsigned nthreads, int op, double duration, double *total)
+{
+  unsigned i;
+  unsigned started = 0;
+  int ret = 0;
+
+  *total = 0;
+  for (i = 0; i < nthreads; i++)
+  {
+    threads[i]->op = op;
+    threads[i]->duration = duration;
+    if (pthread_create(&tids[i], NULL, bench_worker, threads[i]) != 0)
+    {
+      ret = 1;
+      break;
+    }
+    started++;
+  }
+
+  for (i = 0; i < started; i++)
+  {
+    pthread_join(tids[i], NULL);
+    ret |= threads[i]->ret;
+    *total += (double)threads[i]->ops / threads[i]->elapsed;
+  }
+
+  return ret;
+}
+
+int main(int argc, char *argv[])
+{
+  bench_thread **threads;
+  pthread_t *tids;
+  double duration = 1.0, total, single[NOPS];
+  long max_threads = sysconf(_SC_NPROCESSORS_ONLN);
+  unsigned i, n;
+  int op, ret = 0;
+
+  if (argc > 1)
+  {
+    max_threads = strtol(argv[1], NULL, 10);
+  }
+  if (argc > 2)
+  {
+    duration = strtod(argv[2], NULL);
+  }
+  if (argc > 3 || max_threads < 1 || duration <= 0)
+  {
+    fprintf(stderr, "Usage: %s [max_threads [seconds]]\n", argv[0]);
+    return 1;
+  }
+
+  threads = calloc((size_t)max_threads, sizeof(bench_thread *));
+  tids = calloc((size_t)max_threads, sizeof(pthread_t));
+  if (threads == NULL || tids == NULL)
+  {
+    ret = 1;
+    goto cleanup;
+  }
+  for (i = 0; i < (unsigned)max_threads; i++)
+  {
+    threads[i] = malloc(sizeof(bench_thread));
+    if (threads[i] == NULL || bench_setup(threads[i]) != 0)
+    {
+      ret = 1;
+      goto cleanup;
+    }
+  }
+
+  printf("%s, %.1f s per measurement\n", SCHEME, duration);
+  printf("%8s %8s %16s %16s %11s\n", "threads", "op", "ops/s/thread",
+         "ops/s total", "efficiency");
+  for (n = 1; n <= (unsigned)max_threads; n++)
+  {
+    for (op = 0; op < NOPS; op++)
+    {
+      ret |= bench_op(threads, tids, n, op, duration, &total);
+      if (n == 1)
+      {
+        single[op] = total;
+      }
+      printf("%8u %8s %16.1f %16.1f %10.1f%%\n", n, op_names[op], total / n,
+             total, 100.0 * total / (n * single[op]));
+    }
+  }
+
+cleanup:
+  if (threads != NULL)
+  {
+    for (i = 0; i < (unsigned)max_threads; i++)
+    {
+      free(threads[i]);
+    }
+  }
+  free(threads);
+  free(tids);
+  if (ret != 0)
+  {
+    fprintf(stderr, "ERROR (%s,%d)\n", __FILE__, __LINE__);
+  }
+  return ret;
+}
@@ -101,48 +101,118 @@ uint64_t get_cyclecounter(void)
 #include <sys/syscall.h>
 #include <unistd.h>
 
-static int perf_fd = 0;
+/* The events are opened as one group led by the cycle counter, so that
+ * they are scheduled onto the PMU together and read atomically. */
+static const struct
+{
+  uint32_t type;
+  uint64_t config;
+} perf_events[HAL_NUM_EVENTS] = {
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {PERF_TYPE_HW_CACHE,
+     PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+         (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+};
+
+static int perf_fd[HAL_NUM_EVENTS];
+/* Position of each event in the group read, or -1 if it is not counted */
+static int perf_index[HAL_NUM_EVENTS];
+static unsigned perf_nevents = 0;
+
 void enable_cyclecounter(void)
 {
   struct perf_event_attr pe;
-  memset(&pe, 0, sizeof(struct perf_event_attr));
-  pe.type = PERF_TYPE_HARDWARE;
-  pe.size = sizeof(struct perf_event_attr);
-  pe.config = PERF_COUNT_HW_CPU_CYCLES;
-  pe.disabled = 1;
-  pe.exclude_kernel = 1;
-  pe.exclude_hv = 1;
-
-  perf_fd = syscall(__NR_perf_event_open, &pe, 0, -1, -1, 0);
-
-  ioctl(perf_fd, PERF_EVENT_IOC_RESET, 0);
-  ioctl(perf_fd, PERF_EVENT_IOC_ENABLE, 0);
+  unsigned i;
+
+  perf_nevents = 0;
+  for (i = 0; i < HAL_NUM_EVENTS; i++)
+  {
+    memset(&pe, 0, sizeof(struct perf_event_attr));
+    pe.type = perf_events[i].type;
+    pe.size = sizeof(struct perf_event_attr);
+    pe.config = perf_events[i].config;
+    pe.read_format = PERF_FORMAT_GROUP;
+    /* Only the group leader is disabled; members follow it */
+    pe.disabled = i == HAL_EVENT_CYCLES;
+    pe.exclude_kernel = 1;
+    pe.exclude_hv = 1;
+
+    perf_fd[i] = syscall(__NR_perf_event_open, &pe, 0, -1,
+                         i == HAL_EVENT_CYCLES ? -1 : perf_fd[HAL_EVENT_CYCLES],
+                         0);
+    if (perf_fd[i] < 0)
+    {
+      if (i == HAL_EVENT_CYCLES)
+      {
+        perror("perf_event_open");
+        exit(EXIT_FAILURE);
+      }
+      /* Event not supported here: count the others regardless */
+      perf_index[i] = -1;
+      continue;
+    }
+    perf_index[i] = (int)perf_nevents++;
+  }
+
+  ioctl(perf_fd[HAL_EVENT_CYCLES], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+  ioctl(perf_fd[HAL_EVENT_CYCLES], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
 }
 
 void disable_cyclecounter(void)
 {
-  ioctl(perf_fd, PERF_EVENT_IOC_DISABLE, 0);
-  close(perf_fd);
+  unsigned i;
+
+  ioctl(perf_fd[HAL_EVENT_CYCLES], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+  for (i = HAL_NUM_EVENTS; i-- > 0;)
+  {
+    if (perf_index[i] >= 0)
+    {
+      close(perf_fd[i]);
+    }
+  }
 }
 
-uint64_t get_cyclecounter(void)
+unsigned get_counters(uint64_t counters[HAL_NUM_EVENTS])
 {
-  long long cpu_cycles;
-  ioctl(perf_fd, PERF_EVENT_IOC_DISABLE, 0);
-  ssize_t read_count = read(perf_fd, &cpu_cycles, sizeof(cpu_cycles));
+  /* Layout of a PERF_FORMAT_GROUP read: nr, then one value per event */
+  uint64_t values[1 + HAL_NUM_EVENTS];
+  unsigned i, valid = 0;
+  ssize_t read_count;
+
+  ioctl(perf_fd[HAL_EVENT_CYCLES], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+  read_count = read(perf_fd[HAL_EVENT_CYCLES], values, sizeof(values));
   if (read_count < 0)
   {
     perror("read");
     exit(EXIT_FAILURE);
   }
-  else if (read_count == 0)
+  else if (read_count < (ssize_t)((1 + perf_nevents) * sizeof(uint64_t)))
   {
     /* Should not happen */
     printf("perf counter empty\n");
     exit(EXIT_FAILURE);
   }
-  ioctl(perf_fd, PERF_EVENT_IOC_ENABLE, 0);
-  return cpu_cycles;
+  ioctl(perf_fd[HAL_EVENT_CYCLES], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+
+  for (i = 0; i < HAL_NUM_EVENTS; i++)
+  {
+    counters[i] = 0;
+    if (perf_index[i] >= 0)
+    {
+      counters[i] = values[1 + perf_index[i]];
+      valid |= 1u << i;
+    }
+  }
+  return valid;
+}
+
+uint64_t get_cyclecounter(void)
+{
+  uint64_t counters[HAL_NUM_EVENTS];
+  get_counters(counters);
+  return counters[HAL_EVENT_CYCLES];
 }
 #elif defined(MAC_CYCLES)
 /*
@@ -304,3 +374,16 @@ void disable_cyclecounter(void) { return; }
 uint64_t get_cyclecounter(void) { return (0); }
 
 #endif
+
+#if !defined(PERF_CYCLES)
+unsigned get_counters(uint64_t counters[HAL_NUM_EVENTS])
+{
+  unsigned i;
+  for (i = 0; i < HAL_NUM_EVENTS; i++)
+  {
+    counters[i] = 0;
+  }
+  counters[HAL_EVENT_CYCLES] = get_cyclecounter();
+  return 1u << HAL_EVENT_CYCLES;
+}
+#endif /* !PERF_CYCLES */
@@ -32,4 +32,20 @@ void enable_cyclecounter(void);
 void disable_cyclecounter(void);
 uint64_t get_cyclecounter(void);
 
+/* Hardware events which may be counted alongside cycles */
+#define HAL_EVENT_CYCLES 0
+#define HAL_EVENT_INSTRUCTIONS 1
+#define HAL_EVENT_L1D_MISSES 2
+#define HAL_EVENT_BRANCH_MISSES 3
+#define HAL_NUM_EVENTS 4
+
+/*
+ * Reads the current value of all counters into counters[HAL_EVENT_*].
+ *
+ * Returns a bitmask with bit HAL_EVENT_x set if counters[HAL_EVENT_x] is
+ * valid. Cycles are always valid; the other events are only counted by the
+ * PERF_CYCLES backend, and only if the kernel and CPU support them.
+ */
+unsigned get_counters(uint64_t counters[HAL_NUM_EVENTS]);
+
 #endif
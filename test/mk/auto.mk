@@ -1 +1,22 @@
 # SPDX-License-Identifier: Apache-2.0
+#
+# Automatically detect the target architecture and enable the instruction
+# set extensions required by the native backends when the host supports
+# them.
+
+ifndef _AUTO_MK
+_AUTO_MK :=
+
+TARGET_ARCH := $(shell $(CC) -dumpmachine 2>/dev/null | cut -d - -f 1)
+
+# Check whether the host CPU (as seen by the compiler with -march=native)
+# defines the given feature macro. Only meaningful for native builds.
+native_has = $(if $(CROSS_PREFIX),,$(shell echo | $(CC) -march=native -dM -E - 2>/dev/null | grep -q "define $(1) " && echo 1))
+
+ifeq ($(TARGET_ARCH),x86_64)
+ifeq ($(call native_has,__AVX2__),1)
+	CFLAGS += -mavx2 -mbmi2 -mpopcnt
+endif
+endif
+
+endif
@@ -1,9 +1,15 @@
 # SPDX-License-Identifier: Apache-2.0
 
 FIPS202_SRCS = $(wildcard mldsa/fips202/*.c)
+ifeq ($(OPT),1)
+	FIPS202_SRCS += $(wildcard mldsa/fips202/native/*/src/*.c)
+endif
 SOURCES += $(wildcard mldsa/*.c)
+ifeq ($(OPT),1)
+	SOURCES += $(wildcard mldsa/native/*/src/*.c)
+endif
 
-ALL_TESTS = test_mldsa acvp_mldsa bench_mldsa bench_components_mldsa gen_NISTKAT gen_KAT
+ALL_TESTS = test_mldsa test_unit acvp_mldsa bench_mldsa bench_components_mldsa bench_throughput_mldsa gen_NISTKAT gen_KAT
 NON_NIST_TESTS = $(filter-out gen_NISTKAT,$(ALL_TESTS))
 
 MLDSA44_DIR = $(BUILD_DIR)/mldsa44
@@ -21,7 +27,20 @@ $(BUILD_DIR)/libmldsa44.a: $(MLDSA44_OBJS)
 $(BUILD_DIR)/libmldsa65.a: $(MLDSA65_OBJS)
 $(BUILD_DIR)/libmldsa87.a: $(MLDSA87_OBJS)
 
-$(BUILD_DIR)/libmldsa.a: $(MLDSA44_OBJS) $(MLDSA65_OBJS) $(MLDSA87_OBJS)
+# The combined library links code shared between parameter sets (FIPS202,
+# CPU capability detection) only once, plus the unified front-end which
+# dispatches between parameter sets at runtime.
+SHARED_SRCS = mldsa/sys.c
+MULTILEVEL_DIR = $(BUILD_DIR)/multilevel
+MULTILEVEL_OBJS = $(call MAKE_OBJS,$(MULTILEVEL_DIR),$(wildcard mldsa/multilevel/*.c))
+MLDSA65_LEVEL_OBJS = $(call MAKE_OBJS,$(MLDSA65_DIR),$(filter-out $(SHARED_SRCS),$(SOURCES)))
+MLDSA87_LEVEL_OBJS = $(call MAKE_OBJS,$(MLDSA87_DIR),$(filter-out $(SHARED_SRCS),$(SOURCES)))
+
+$(BUILD_DIR)/libmldsa.a: $(MLDSA44_OBJS) $(MLDSA65_LEVEL_OBJS) $(MLDSA87_LEVEL_OBJS) $(MULTILEVEL_OBJS)
+
+$(MULTILEVEL_DIR)/bin/test_multilevel: LDLIBS += -L$(BUILD_DIR) -lmldsa
+$(MULTILEVEL_DIR)/bin/test_multilevel: $(MULTILEVEL_DIR)/test/test_multilevel.c.o $(BUILD_DIR)/libmldsa.a \
+	$(call MAKE_OBJS, $(MULTILEVEL_DIR), $(wildcard test/notrandombytes/*.c))
 
 $(MLDSA44_DIR)/bin/bench_mldsa44: CFLAGS += -Itest/hal
 $(MLDSA65_DIR)/bin/bench_mldsa65: CFLAGS += -Itest/hal
@@ -37,6 +56,10 @@ $(MLDSA44_DIR)/bin/bench_components_mldsa44: $(MLDSA44_DIR)/test/hal/hal.c.o
 $(MLDSA65_DIR)/bin/bench_components_mldsa65: $(MLDSA65_DIR)/test/hal/hal.c.o
 $(MLDSA87_DIR)/bin/bench_components_mldsa87: $(MLDSA87_DIR)/test/hal/hal.c.o
 
+$(MLDSA44_DIR)/bin/bench_throughput_mldsa44: CFLAGS += -pthread
+$(MLDSA65_DIR)/bin/bench_throughput_mldsa65: CFLAGS += -pthread
+$(MLDSA87_DIR)/bin/bench_throughput_mldsa87: CFLAGS += -pthread
+
 $(MLDSA44_DIR)/bin/%: CFLAGS += -DMLDSA_MODE=2
 $(MLDSA65_DIR)/bin/%: CFLAGS += -DMLDSA_MODE=3
 $(MLDSA87_DIR)/bin/%: CFLAGS += -DMLDSA_MODE=5
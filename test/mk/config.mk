@@ -80,6 +80,11 @@ CYCLES ?=
 OPT ?= 1
 RETAINED_VARS := CROSS_PREFIX CYCLES OPT AUTO
 
+ifeq ($(OPT),1)
+	CFLAGS += -DMLD_CONFIG_USE_NATIVE_BACKEND_FIPS202
+	CFLAGS += -DMLD_CONFIG_USE_NATIVE_BACKEND_ARITH
+endif
+
 ifeq ($(AUTO),1)
 include test/mk/auto.mk
 endif
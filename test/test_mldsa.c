@@ -3,15 +3,31 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#if defined(__linux__)
+#if !defined(_GNU_SOURCE)
+/* Ensure that the ucontext functions are declared with -std=c99 */
+#define _GNU_SOURCE
+#endif
+#endif /* __linux__ */
+
 #include <stddef.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include "../mldsa/api.h"
 #include "notrandombytes/notrandombytes.h"
 
+#if defined(__linux__)
+#include <ucontext.h>
+#endif
+
 #define NTESTS 100
 #define MLEN 59
 #define CTXLEN 1
+#define NBATCH 7
+#define NIDENTICAL 20
+/* Upper bound on the stack usage of the _ws variants, in bytes */
+#define WS_STACK_BOUND (16 * 1024)
 
 static int test_sign(void)
 {
@@ -62,6 +78,438 @@ static int test_sign(void)
   return 0;
 }
 
+static int test_sign_expanded(void)
+{
+  uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[CRYPTO_SECRETKEYBYTES];
+  uint8_t sig[CRYPTO_BYTES];
+  uint8_t m[MLEN];
+  uint8_t ctx[CTXLEN];
+  struct crypto_sign_expanded_sk *esk;
+  size_t siglen;
+  int rc;
+
+  esk = malloc(CRYPTO_EXPANDEDSKBYTES);
+  if (esk == NULL)
+  {
+    printf("ERROR: sign_expanded: malloc\n");
+    return 1;
+  }
+
+  crypto_sign_keypair(pk, sk);
+  crypto_sign_expand_sk(esk, sk);
+  randombytes(ctx, CTXLEN);
+  randombytes(m, MLEN);
+
+  rc = crypto_sign_signature_expanded(sig, &siglen, m, MLEN, ctx, CTXLEN, esk);
+  free(esk);
+
+  if (rc || siglen != CRYPTO_BYTES)
+  {
+    printf("ERROR: crypto_sign_signature_expanded\n");
+    return 1;
+  }
+
+  rc = crypto_sign_verify(sig, siglen, m, MLEN, ctx, CTXLEN, pk);
+  if (rc)
+  {
+    printf("ERROR: sign_expanded: crypto_sign_verify\n");
+    return 1;
+  }
+
+  return 0;
+}
+
+static int test_sign_stream(void)
+{
+  uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[CRYPTO_SECRETKEYBYTES];
+  uint8_t sig[CRYPTO_BYTES];
+  uint8_t m[MLEN];
+  uint8_t ctx[CTXLEN];
+  struct crypto_sign_ctx *sctx;
+  size_t siglen;
+  size_t pos, chunk;
+  int rc;
+
+  sctx = calloc(1, CRYPTO_SIGNCTXBYTES);
+  if (sctx == NULL)
+  {
+    printf("ERROR: sign_stream: malloc\n");
+    return 1;
+  }
+
+  crypto_sign_keypair(pk, sk);
+  randombytes(ctx, CTXLEN);
+  randombytes(m, MLEN);
+
+  /* absorb message in chunks of random length */
+  rc = crypto_sign_init(sctx, sk, ctx, CTXLEN);
+  for (pos = 0; pos < MLEN; pos += chunk)
+  {
+    randombytes((uint8_t *)&chunk, sizeof(size_t));
+    chunk %= MLEN - pos + 1;
+    rc |= crypto_sign_update(sctx, m + pos, chunk);
+  }
+  rc |= crypto_sign_final(sctx, sig, &siglen);
+
+  /* The signing state, which includes the secret key, has been cleared.
+   * sctx was zero-initialized, so this covers the whole buffer. */
+  for (pos = 0; pos < CRYPTO_SIGNCTXBYTES; pos++)
+  {
+    rc |= ((uint8_t *)sctx)[pos];
+  }
+  free(sctx);
+
+  if (rc || siglen != CRYPTO_BYTES)
+  {
+    printf("ERROR: crypto_sign_final\n");
+    return 1;
+  }
+
+  rc = crypto_sign_verify(sig, siglen, m, MLEN, ctx, CTXLEN, pk);
+  if (rc)
+  {
+    printf("ERROR: sign_stream: crypto_sign_verify\n");
+    return 1;
+  }
+
+  return 0;
+}
+
+static int test_verify_expanded(void)
+{
+  uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[CRYPTO_SECRETKEYBYTES];
+  uint8_t sig[CRYPTO_BYTES];
+  uint8_t m[MLEN];
+  uint8_t ctx[CTXLEN];
+  struct crypto_sign_expanded_pk *epk;
+  size_t siglen;
+  size_t idx;
+  int rc, rc_wrong;
+
+  epk = malloc(CRYPTO_EXPANDEDPKBYTES);
+  if (epk == NULL)
+  {
+    printf("ERROR: verify_expanded: malloc\n");
+    return 1;
+  }
+
+  crypto_sign_keypair(pk, sk);
+  crypto_sign_expand_pk(epk, pk);
+  randombytes(ctx, CTXLEN);
+  randombytes(m, MLEN);
+
+  crypto_sign_signature(sig, &siglen, m, MLEN, ctx, CTXLEN, sk);
+  rc = crypto_sign_verify_expanded(sig, siglen, m, MLEN, ctx, CTXLEN, epk);
+
+  /* flip bit in signature */
+  randombytes((uint8_t *)&idx, sizeof(size_t));
+  idx %= CRYPTO_BYTES;
+  sig[idx] ^= 1;
+  rc_wrong =
+      crypto_sign_verify_expanded(sig, siglen, m, MLEN, ctx, CTXLEN, epk);
+  free(epk);
+
+  if (rc)
+  {
+    printf("ERROR: crypto_sign_verify_expanded\n");
+    return 1;
+  }
+
+  if (!rc_wrong)
+  {
+    printf("ERROR: verify_expanded: wrong signature accepted\n");
+    return 1;
+  }
+
+  return 0;
+}
+
+static int test_verify_stream(void)
+{
+  uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[CRYPTO_SECRETKEYBYTES];
+  uint8_t sig[CRYPTO_BYTES];
+  uint8_t m[MLEN];
+  uint8_t ctx[CTXLEN];
+  struct crypto_verify_ctx *vctx;
+  size_t siglen;
+  size_t pos, chunk, idx;
+  int rc, rc_wrong;
+
+  vctx = malloc(CRYPTO_VERIFYCTXBYTES);
+  if (vctx == NULL)
+  {
+    printf("ERROR: verify_stream: malloc\n");
+    return 1;
+  }
+
+  crypto_sign_keypair(pk, sk);
+  randombytes(ctx, CTXLEN);
+  randombytes(m, MLEN);
+  crypto_sign_signature(sig, &siglen, m, MLEN, ctx, CTXLEN, sk);
+
+  /* absorb message in chunks of random length */
+  rc = crypto_verify_init(vctx, pk, ctx, CTXLEN);
+  for (pos = 0; pos < MLEN; pos += chunk)
+  {
+    randombytes((uint8_t *)&chunk, sizeof(size_t));
+    chunk %= MLEN - pos + 1;
+    rc |= crypto_verify_update(vctx, m + pos, chunk);
+  }
+  rc |= crypto_verify_final(vctx, sig, siglen);
+
+  /* flip bit in message */
+  randombytes((uint8_t *)&idx, sizeof(size_t));
+  idx %= MLEN;
+  m[idx] ^= 1;
+  rc_wrong = crypto_verify_init(vctx, pk, ctx, CTXLEN);
+  rc_wrong |= crypto_verify_update(vctx, m, MLEN);
+  rc_wrong |= crypto_verify_final(vctx, sig, siglen);
+  free(vctx);
+
+  if (rc)
+  {
+    printf("ERROR: crypto_verify_final\n");
+    return 1;
+  }
+
+  if (!rc_wrong)
+  {
+    printf("ERROR: verify_stream: wrong message accepted\n");
+    return 1;
+  }
+
+  return 0;
+}
+
+static int test_verify_batch(void)
+{
+  uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[CRYPTO_SECRETKEYBYTES];
+  uint8_t sig[NBATCH][CRYPTO_BYTES];
+  uint8_t m[NBATCH][MLEN];
+  uint8_t ctx[CTXLEN];
+  const uint8_t *sigs[NBATCH];
+  const uint8_t *ms[NBATCH];
+  size_t siglens[NBATCH];
+  size_t mlens[NBATCH];
+  int results[NBATCH];
+  size_t i, idx, wrong;
+  int rc, rc_wrong;
+
+  crypto_sign_keypair(pk, sk);
+  randombytes(ctx, CTXLEN);
+
+  for (i = 0; i < NBATCH; i++)
+  {
+    randombytes(m[i], MLEN);
+    crypto_sign_signature(sig[i], &siglens[i], m[i], MLEN, ctx, CTXLEN, sk);
+    sigs[i] = sig[i];
+    ms[i] = m[i];
+    mlens[i] = MLEN;
+  }
+
+  rc = crypto_sign_verify_batch(sigs, siglens, ms, mlens, NBATCH, ctx, CTXLEN,
+                                pk, results);
+  if (rc)
+  {
+    printf("ERROR: crypto_sign_verify_batch\n");
+    return 1;
+  }
+  for (i = 0; i < NBATCH; i++)
+  {
+    if (results[i] != 0)
+    {
+      printf("ERROR: verify_batch: signature %d rejected\n", (int)i);
+      return 1;
+    }
+  }
+
+  /* flip bit in one of the signatures */
+  randombytes((uint8_t *)&wrong, sizeof(size_t));
+  wrong %= NBATCH;
+  randombytes((uint8_t *)&idx, sizeof(size_t));
+  idx %= CRYPTO_BYTES;
+  sig[wrong][idx] ^= 1;
+
+  rc_wrong = crypto_sign_verify_batch(sigs, siglens, ms, mlens, NBATCH, ctx,
+                                      CTXLEN, pk, results);
+  if (!rc_wrong)
+  {
+    printf("ERROR: verify_batch: wrong signature accepted\n");
+    return 1;
+  }
+  for (i = 0; i < NBATCH; i++)
+  {
+    if ((results[i] != 0) != (i == wrong))
+    {
+      printf("ERROR: verify_batch: wrong result for signature %d\n", (int)i);
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+static int test_ws(void)
+{
+  uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[CRYPTO_SECRETKEYBYTES];
+  uint8_t sig[CRYPTO_BYTES];
+  uint8_t m[MLEN];
+  uint8_t ctx[CTXLEN];
+  struct crypto_sign_workspace *ws;
+  size_t siglen;
+  int rc, rc_wrong;
+
+  ws = malloc(CRYPTO_WORKSPACEBYTES);
+  if (ws == NULL)
+  {
+    printf("ERROR: ws: malloc\n");
+    return 1;
+  }
+
+  randombytes(ctx, CTXLEN);
+  randombytes(m, MLEN);
+
+  rc = crypto_sign_keypair_ws(pk, sk, ws);
+  rc |= crypto_sign_signature_ws(sig, &siglen, m, MLEN, ctx, CTXLEN, sk, ws);
+  rc |= crypto_sign_verify_ws(sig, siglen, m, MLEN, ctx, CTXLEN, pk, ws);
+  /* Interoperates with the regular API */
+  rc |= crypto_sign_verify(sig, siglen, m, MLEN, ctx, CTXLEN, pk);
+  rc |= crypto_sign_signature(sig, &siglen, m, MLEN, ctx, CTXLEN, sk);
+  rc |= crypto_sign_verify_ws(sig, siglen, m, MLEN, ctx, CTXLEN, pk, ws);
+
+  m[0] ^= 1;
+  rc_wrong = crypto_sign_verify_ws(sig, siglen, m, MLEN, ctx, CTXLEN, pk, ws);
+  free(ws);
+
+  if (rc)
+  {
+    printf("ERROR: ws\n");
+    return 1;
+  }
+
+  if (!rc_wrong)
+  {
+    printf("ERROR: ws: wrong message accepted\n");
+    return 1;
+  }
+
+  return 0;
+}
+
+#if defined(__linux__)
+#define STACK_SIZE (512 * 1024)
+#define STACK_PAINT 0xA5
+
+static ucontext_t stack_main_ctx, stack_fn_ctx;
+static struct crypto_sign_workspace *stack_ws;
+static int stack_rc;
+
+/* Kept off the measured stack */
+static uint8_t stack_pk[CRYPTO_PUBLICKEYBYTES];
+static uint8_t stack_sk[CRYPTO_SECRETKEYBYTES];
+static uint8_t stack_sig[CRYPTO_BYTES];
+static uint8_t stack_m[MLEN];
+static size_t stack_siglen;
+
+static void stack_run_ws(void)
+{
+  stack_rc = crypto_sign_keypair_ws(stack_pk, stack_sk, stack_ws);
+  stack_rc |= crypto_sign_signature_ws(stack_sig, &stack_siglen, stack_m,
+                                       MLEN, NULL, 0, stack_sk, stack_ws);
+  stack_rc |= crypto_sign_verify_ws(stack_sig, stack_siglen, stack_m, MLEN,
+                                    NULL, 0, stack_pk, stack_ws);
+}
+
+static void stack_run(void)
+{
+  stack_rc = crypto_sign_keypair(stack_pk, stack_sk);
+  stack_rc |= crypto_sign_signature(stack_sig, &stack_siglen, stack_m, MLEN,
+                                    NULL, 0, stack_sk);
+  stack_rc |= crypto_sign_verify(stack_sig, stack_siglen, stack_m, MLEN, NULL,
+                                 0, stack_pk);
+}
+
+/*
+ * Runs fn on a painted stack of its own and returns the number of bytes of
+ * that stack it touched, or 0 on failure. Assumes a downward-growing stack.
+ */
+static size_t stack_usage(void (*fn)(void))
+{
+  uint8_t *stack;
+  size_t untouched;
+
+  stack = malloc(STACK_SIZE);
+  if (stack == NULL)
+  {
+    return 0;
+  }
+  memset(stack, STACK_PAINT, STACK_SIZE);
+
+  stack_rc = -1;
+  if (getcontext(&stack_fn_ctx) != 0)
+  {
+    free(stack);
+    return 0;
+  }
+  stack_fn_ctx.uc_stack.ss_sp = stack;
+  stack_fn_ctx.uc_stack.ss_size = STACK_SIZE;
+  stack_fn_ctx.uc_link = &stack_main_ctx;
+  makecontext(&stack_fn_ctx, fn, 0);
+  if (swapcontext(&stack_main_ctx, &stack_fn_ctx) != 0 || stack_rc != 0)
+  {
+    free(stack);
+    return 0;
+  }
+
+  for (untouched = 0; untouched < STACK_SIZE; untouched++)
+  {
+    if (stack[untouched] != STACK_PAINT)
+    {
+      break;
+    }
+  }
+  free(stack);
+  return STACK_SIZE - untouched;
+}
+
+static int test_ws_stack(void)
+{
+  size_t used_ws, used;
+
+  stack_ws = malloc(CRYPTO_WORKSPACEBYTES);
+  if (stack_ws == NULL)
+  {
+    printf("ERROR: ws_stack: malloc\n");
+    return 1;
+  }
+  used_ws = stack_usage(stack_run_ws);
+  used = stack_usage(stack_run);
+  free(stack_ws);
+
+  if (used_ws == 0 || used == 0)
+  {
+    printf("ERROR: ws_stack: failed to run\n");
+    return 1;
+  }
+
+  /* The measurement must see the stack frames of the regular API */
+  if (used_ws > WS_STACK_BOUND || used <= WS_STACK_BOUND)
+  {
+    printf("ERROR: ws_stack: %u bytes used with workspace, %u without\n",
+           (unsigned)used_ws, (unsigned)used);
+    return 1;
+  }
+
+  return 0;
+}
+#endif /* __linux__ */
+
 static int test_wrong_pk(void)
 {
   uint8_t pk[CRYPTO_PUBLICKEYBYTES];
@@ -198,6 +646,161 @@ static int test_wrong_ctx(void)
   return 0;
 }
 
+#if defined(MLD_CONFIG_SIGN_STATS)
+static int test_sign_stats(void)
+{
+  uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[CRYPTO_SECRETKEYBYTES];
+  uint8_t sig[CRYPTO_BYTES];
+  uint8_t m[MLEN];
+  uint8_t ctx[CTXLEN];
+  size_t siglen;
+  struct MLD_ref_sign_stats stats;
+  uint64_t calls = 0;
+  unsigned i;
+
+  crypto_sign_keypair(pk, sk);
+  randombytes(ctx, CTXLEN);
+  randombytes(m, MLEN);
+
+  crypto_sign_stats_reset();
+  crypto_sign_signature(sig, &siglen, m, MLEN, ctx, CTXLEN, sk);
+  crypto_sign_stats(&stats);
+
+  for (i = 0; i < MLD_SIGN_STATS_HISTBINS; i++)
+  {
+    calls += stats.hist[i];
+  }
+  if (stats.calls != 1 || calls != 1 || stats.attempts == 0 ||
+      stats.last_attempts != stats.attempts)
+  {
+    printf("ERROR: sign_stats: calls or attempts\n");
+    return 1;
+  }
+#if !defined(MLD_CONFIG_SIGN_THREADS) || MLD_CONFIG_SIGN_THREADS <= 1
+  /* All but the last attempt are rejected. With threads, speculative
+   * attempts are counted as well. */
+  if (stats.reject_z + stats.reject_w0 + stats.reject_ct0 +
+          stats.reject_hints !=
+      stats.attempts - 1)
+  {
+    printf("ERROR: sign_stats: rejections\n");
+    return 1;
+  }
+#endif /* !MLD_CONFIG_SIGN_THREADS || MLD_CONFIG_SIGN_THREADS <= 1 */
+
+  return 0;
+}
+#endif /* MLD_CONFIG_SIGN_STATS */
+
+/*
+ * Resets the test RNG and derives the key pair, context and the i-th
+ * message from it. Signing draws its randomness rnd from randombytes()
+ * next, so calling this before each of several signing functions makes
+ * them sign with the same key, message, context and rnd.
+ */
+static void sign_identical_setup(uint8_t pk[CRYPTO_PUBLICKEYBYTES],
+                                 uint8_t sk[CRYPTO_SECRETKEYBYTES],
+                                 uint8_t m[MLEN], uint8_t ctx[CTXLEN],
+                                 unsigned int i)
+{
+  unsigned int j;
+
+  randombytes_reset();
+  crypto_sign_keypair(pk, sk);
+  randombytes(ctx, CTXLEN);
+  for (j = 0; j <= i; j++)
+  {
+    randombytes(m, MLEN);
+  }
+}
+
+/*
+ * Checks that the signing variants produce exactly the signature of
+ * crypto_sign_signature. As this restarts the test RNG, it runs after the
+ * randomized tests. crypto_sign_signature_ws always signs serially, so
+ * with MLD_CONFIG_SIGN_THREADS or MLD_CONFIG_SIGN_4X this also compares
+ * the parallel rejection loop against the serial one.
+ */
+static int test_sign_identical(void)
+{
+  uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[CRYPTO_SECRETKEYBYTES];
+  uint8_t sig_ref[CRYPTO_BYTES];
+  uint8_t sig[CRYPTO_BYTES];
+  uint8_t m[MLEN];
+  uint8_t ctx[CTXLEN];
+  struct crypto_sign_expanded_sk *esk;
+  struct crypto_sign_ctx *sctx;
+  struct crypto_sign_workspace *ws;
+  size_t siglen, pos, chunk;
+  unsigned int i, k;
+  int rc;
+
+  esk = malloc(CRYPTO_EXPANDEDSKBYTES);
+  sctx = malloc(CRYPTO_SIGNCTXBYTES);
+  ws = malloc(CRYPTO_WORKSPACEBYTES);
+  if (esk == NULL || sctx == NULL || ws == NULL)
+  {
+    printf("ERROR: sign_identical: malloc\n");
+    free(esk);
+    free(sctx);
+    free(ws);
+    return 1;
+  }
+
+  for (i = 0; i < NIDENTICAL; i++)
+  {
+    sign_identical_setup(pk, sk, m, ctx, i);
+    rc = crypto_sign_signature(sig_ref, &siglen, m, MLEN, ctx, CTXLEN, sk);
+
+    sign_identical_setup(pk, sk, m, ctx, i);
+    crypto_sign_expand_sk(esk, sk);
+    rc |=
+        crypto_sign_signature_expanded(sig, &siglen, m, MLEN, ctx, CTXLEN, esk);
+    if (rc || memcmp(sig, sig_ref, CRYPTO_BYTES) != 0)
+    {
+      printf("ERROR: crypto_sign_signature_expanded differs\n");
+      goto fail;
+    }
+
+    /* Chunk lengths must not be drawn from the RNG, which provides rnd */
+    sign_identical_setup(pk, sk, m, ctx, i);
+    rc = crypto_sign_init(sctx, sk, ctx, CTXLEN);
+    for (pos = 0, k = 0; pos < MLEN; pos += chunk, k++)
+    {
+      chunk = (5 * k + i) % 17;
+      chunk = chunk < MLEN - pos ? chunk : MLEN - pos;
+      rc |= crypto_sign_update(sctx, m + pos, chunk);
+    }
+    rc |= crypto_sign_final(sctx, sig, &siglen);
+    if (rc || memcmp(sig, sig_ref, CRYPTO_BYTES) != 0)
+    {
+      printf("ERROR: crypto_sign_final differs\n");
+      goto fail;
+    }
+
+    sign_identical_setup(pk, sk, m, ctx, i);
+    rc = crypto_sign_signature_ws(sig, &siglen, m, MLEN, ctx, CTXLEN, sk, ws);
+    if (rc || memcmp(sig, sig_ref, CRYPTO_BYTES) != 0)
+    {
+      printf("ERROR: crypto_sign_signature_ws differs\n");
+      goto fail;
+    }
+  }
+
+  free(esk);
+  free(sctx);
+  free(ws);
+  return 0;
+
+fail:
+  free(esk);
+  free(sctx);
+  free(ws);
+  return 1;
+}
+
 int main(void)
 {
   unsigned i;
@@ -210,15 +813,36 @@ int main(void)
   for (i = 0; i < NTESTS; i++)
   {
     r = test_sign();
+    r |= test_sign_expanded();
+    r |= test_sign_stream();
+    r |= test_verify_expanded();
+    r |= test_verify_stream();
+    r |= test_verify_batch();
+    r |= test_ws();
     r |= test_wrong_pk();
     r |= test_wrong_sig();
     r |= test_wrong_ctx();
+#if defined(MLD_CONFIG_SIGN_STATS)
+    r |= test_sign_stats();
+#endif
     if (r)
     {
       return 1;
     }
   }
 
+  if (test_sign_identical())
+  {
+    return 1;
+  }
+
+#if defined(__linux__)
+  if (test_ws_stack())
+  {
+    return 1;
+  }
+#endif
+
   printf("CRYPTO_SECRETKEYBYTES:  %d\n", CRYPTO_SECRETKEYBYTES);
   printf("CRYPTO_PUBLICKEYBYTES:  %d\n", CRYPTO_PUBLICKEYBYTES);
   printf("CRYPTO_BYTES: %d\n", CRYPTO_BYTES);
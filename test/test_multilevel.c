@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Tests for the unified interface of the combined library, which selects
+ * the parameter set at runtime.
+ */
+
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include "../mldsa/api.h"
+#include "notrandombytes/notrandombytes.h"
+
+#define NTESTS 10
+#define MLEN 59
+#define CTXLEN 1
+
+#define CHECK(x)                                              \
+  do                                                          \
+  {                                                           \
+    if (!(x))                                                 \
+    {                                                         \
+      fprintf(stderr, "ERROR (%s,%d)\n", __FILE__, __LINE__); \
+      return 1;                                               \
+    }                                                         \
+  } while (0)
+
+typedef struct
+{
+  int level;
+  size_t pkbytes;
+  size_t skbytes;
+  size_t sigbytes;
+  int (*verify)(const uint8_t *sig, size_t siglen, const uint8_t *m,
+                size_t mlen, const uint8_t *ctx, size_t ctxlen,
+                const uint8_t *pk);
+} level_info;
+
+static const level_info levels[] = {
+    {MLD_LEVEL_44, MLD_44_PUBLICKEYBYTES, MLD_44_SECRETKEYBYTES, MLD_44_BYTES,
+     MLD_44_ref_verify},
+    {MLD_LEVEL_65, MLD_65_PUBLICKEYBYTES, MLD_65_SECRETKEYBYTES, MLD_65_BYTES,
+     MLD_65_ref_verify},
+    {MLD_LEVEL_87, MLD_87_PUBLICKEYBYTES, MLD_87_SECRETKEYBYTES, MLD_87_BYTES,
+     MLD_87_ref_verify},
+};
+
+static int test_level(const level_info *info)
+{
+  struct mld_public_key pk, pk2;
+  struct mld_secret_key sk, sk2;
+  struct mld_signature sig, sig2;
+  uint8_t m[MLEN];
+  uint8_t ctx[CTXLEN];
+
+  CHECK(mld_publickeybytes(info->level) == info->pkbytes);
+  CHECK(mld_secretkeybytes(info->level) == info->skbytes);
+  CHECK(mld_signaturebytes(info->level) == info->sigbytes);
+
+  randombytes(m, MLEN);
+  randombytes(ctx, CTXLEN);
+
+  CHECK(mld_keypair(info->level, &pk, &sk) == 0);
+  CHECK(pk.level == info->level && sk.level == info->level);
+  CHECK(mld_sign(&sig, m, MLEN, ctx, CTXLEN, &sk) == 0);
+  CHECK(sig.level == info->level && sig.len == info->sigbytes);
+  CHECK(mld_verify(&sig, m, MLEN, ctx, CTXLEN, &pk) == 0);
+
+  /* The signature was produced by the build of the requested level */
+  CHECK(info->verify(sig.bytes, sig.len, m, MLEN, ctx, CTXLEN, pk.bytes) ==
+        0);
+
+  /* Import of encoded keys and signatures */
+  CHECK(mld_import_pk(&pk2, info->level, pk.bytes, info->pkbytes) == 0);
+  CHECK(mld_import_sk(&sk2, info->level, sk.bytes, info->skbytes) == 0);
+  CHECK(mld_import_sig(&sig2, info->level, sig.bytes, info->sigbytes) == 0);
+  CHECK(mld_verify(&sig2, m, MLEN, ctx, CTXLEN, &pk2) == 0);
+  CHECK(mld_sign(&sig2, m, MLEN, ctx, CTXLEN, &sk2) == 0);
+  CHECK(mld_verify(&sig2, m, MLEN, ctx, CTXLEN, &pk) == 0);
+  CHECK(mld_import_pk(&pk2, info->level, pk.bytes, info->pkbytes - 1) != 0);
+  CHECK(mld_import_sig(&sig2, info->level, sig.bytes, info->sigbytes + 1) !=
+        0);
+
+  /* Tampered message */
+  m[0] ^= 1;
+  CHECK(mld_verify(&sig, m, MLEN, ctx, CTXLEN, &pk) != 0);
+
+  return 0;
+}
+
+static int test_mismatch(void)
+{
+  struct mld_public_key pk44, pk65;
+  struct mld_secret_key sk44, sk65;
+  struct mld_signature sig;
+  uint8_t m[MLEN];
+
+  randombytes(m, MLEN);
+  CHECK(mld_keypair(MLD_LEVEL_44, &pk44, &sk44) == 0);
+  CHECK(mld_keypair(MLD_LEVEL_65, &pk65, &sk65) == 0);
+
+  /* Signature and public key of different levels */
+  CHECK(mld_sign(&sig, m, MLEN, NULL, 0, &sk44) == 0);
+  CHECK(mld_verify(&sig, m, MLEN, NULL, 0, &pk44) == 0);
+  CHECK(mld_verify(&sig, m, MLEN, NULL, 0, &pk65) != 0);
+
+  /* Unknown levels */
+  CHECK(mld_publickeybytes(0) == 0);
+  CHECK(mld_secretkeybytes(2) == 0);
+  CHECK(mld_signaturebytes(-1) == 0);
+  CHECK(mld_keypair(3, &pk44, &sk44) != 0);
+  CHECK(mld_import_pk(&pk44, 99, pk65.bytes, MLD_65_PUBLICKEYBYTES) != 0);
+  sk65.level = 5;
+  CHECK(mld_sign(&sig, m, MLEN, NULL, 0, &sk65) != 0);
+
+  return 0;
+}
+
+int main(void)
+{
+  unsigned i, j;
+  int r = 0;
+
+  /* WARNING: Test-only
+   * Normally, you would want to seed a PRNG with trustworthy entropy here. */
+  randombytes_reset();
+
+  for (i = 0; i < NTESTS; i++)
+  {
+    for (j = 0; j < sizeof(levels) / sizeof(levels[0]); j++)
+    {
+      r |= test_level(&levels[j]);
+    }
+  }
+  r |= test_mismatch();
+
+  if (r)
+  {
+    return 1;
+  }
+
+  printf("Multi-level tests passed\n");
+  return 0;
+}
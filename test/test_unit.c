@@ -0,0 +1,768 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Unit tests for the native backends: each native function is compared
+ * against the C reference implementation on random inputs. The 4-way
+ * Keccak, natively implemented or not, is compared against the scalar one.
+ */
+
+#if defined(__linux__)
+#if !defined(_GNU_SOURCE)
+/* Ensure that setenv() and unsetenv() are declared with -std=c99 */
+#define _GNU_SOURCE
+#endif
+#endif /* __linux__ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../mldsa/common.h"
+#include "../mldsa/fips202/fips202.h"
+#include "../mldsa/fips202/fips202x4.h"
+#include "../mldsa/fips202/keccakf1600.h"
+#include "../mldsa/sign.h"
+#include "notrandombytes/notrandombytes.h"
+
+#define NTESTS 1000
+
+#define CHECK(x)                                              \
+  do                                                          \
+  {                                                           \
+    if (!(x))                                                 \
+    {                                                         \
+      fprintf(stderr, "ERROR (%s,%d)\n", __FILE__, __LINE__); \
+      return 1;                                               \
+    }                                                         \
+  } while (0)
+
+#if defined(MLD_USE_NATIVE_NTT) || defined(MLD_USE_NATIVE_INTT)
+#include "../mldsa/reduce.h"
+#include "../mldsa/zetas.inc"
+
+/* Sample a polynomial with coefficients in (-bound, bound) */
+static void rand_poly(int32_t a[MLDSA_N], int32_t bound)
+{
+  unsigned int i;
+  uint32_t t;
+
+  for (i = 0; i < MLDSA_N; i++)
+  {
+    randombytes((uint8_t *)&t, sizeof(t));
+    a[i] = (int32_t)(t % (uint32_t)(2 * bound - 1)) - (bound - 1);
+  }
+}
+
+static int32_t fqmul_ref(int32_t a, int32_t b)
+{
+  return montgomery_reduce((int64_t)a * b);
+}
+#endif /* MLD_USE_NATIVE_NTT || MLD_USE_NATIVE_INTT */
+
+#if defined(MLD_USE_NATIVE_NTT)
+/* Reference implementation of ntt, see mldsa/ntt.c */
+static void ntt_ref(int32_t a[MLDSA_N])
+{
+  unsigned int len, start, j, k;
+  int32_t zeta, t;
+
+  k = 0;
+  for (len = 128; len > 0; len >>= 1)
+  {
+    for (start = 0; start < MLDSA_N; start = j + len)
+    {
+      zeta = zetas[++k];
+      for (j = start; j < start + len; ++j)
+      {
+        t = fqmul_ref(zeta, a[j + len]);
+        a[j + len] = a[j] - t;
+        a[j] = a[j] + t;
+      }
+    }
+  }
+}
+
+static int test_ntt_native(void)
+{
+  int32_t a[MLDSA_N], a_ref[MLDSA_N];
+  unsigned int i, j;
+
+  for (i = 0; i < NTESTS; i++)
+  {
+    rand_poly(a, MLDSA_Q);
+    memcpy(a_ref, a, sizeof(a));
+
+    ntt_ref(a_ref);
+    if (ntt_native(a) != MLD_NATIVE_FUNC_SUCCESS)
+    {
+      printf("ntt_native not supported by this CPU, skipped\n");
+      return 0;
+    }
+
+    CHECK(memcmp(a, a_ref, sizeof(a)) == 0);
+    for (j = 0; j < MLDSA_N; j++)
+    {
+      CHECK(a[j] > -9 * MLDSA_Q && a[j] < 9 * MLDSA_Q);
+    }
+  }
+
+  return 0;
+}
+#endif /* MLD_USE_NATIVE_NTT */
+
+#if defined(MLD_USE_NATIVE_INTT)
+/* Reference implementation of invntt_tomont, see mldsa/ntt.c */
+static void intt_ref(int32_t a[MLDSA_N])
+{
+  unsigned int start, len, j, k;
+  int32_t t, zeta;
+  const int32_t f = 41978; /* mont^2/256 */
+
+  k = 256;
+  for (len = 1; len < MLDSA_N; len <<= 1)
+  {
+    for (start = 0; start < MLDSA_N; start = j + len)
+    {
+      zeta = -zetas[--k];
+      for (j = start; j < start + len; ++j)
+      {
+        t = a[j];
+        a[j] = t + a[j + len];
+        a[j + len] = fqmul_ref(t - a[j + len], zeta);
+      }
+    }
+  }
+
+  for (j = 0; j < MLDSA_N; ++j)
+  {
+    a[j] = fqmul_ref(a[j], f);
+  }
+}
+
+static int test_intt_native(void)
+{
+  int32_t a[MLDSA_N], a_ref[MLDSA_N];
+  unsigned int i, j;
+
+  for (i = 0; i < NTESTS; i++)
+  {
+    rand_poly(a, MLDSA_Q);
+    memcpy(a_ref, a, sizeof(a));
+
+    intt_ref(a_ref);
+    if (intt_native(a) != MLD_NATIVE_FUNC_SUCCESS)
+    {
+      printf("intt_native not supported by this CPU, skipped\n");
+      return 0;
+    }
+
+    CHECK(memcmp(a, a_ref, sizeof(a)) == 0);
+    for (j = 0; j < MLDSA_N; j++)
+    {
+      CHECK(a[j] > -MLDSA_Q && a[j] < MLDSA_Q);
+    }
+  }
+
+  return 0;
+}
+#endif /* MLD_USE_NATIVE_INTT */
+
+#if defined(MLD_USE_NATIVE_REJ_UNIFORM)
+
+/* Reference implementation of rej_uniform, see mldsa/poly.c */
+static unsigned int rej_uniform_ref(int32_t *a, unsigned int len,
+                                    const uint8_t *buf, unsigned int buflen)
+{
+  unsigned int ctr, pos;
+  uint32_t t;
+
+  ctr = pos = 0;
+  while (ctr < len && pos + 3 <= buflen)
+  {
+    t = buf[pos++];
+    t |= (uint32_t)buf[pos++] << 8;
+    t |= (uint32_t)buf[pos++] << 16;
+    t &= 0x7FFFFF;
+
+    if (t < MLDSA_Q)
+    {
+      a[ctr++] = (int32_t)t;
+    }
+  }
+
+  return ctr;
+}
+
+#define REJ_UNIFORM_MAX_BUFLEN (5 * 168)
+static int test_rej_uniform_native(void)
+{
+  uint8_t buf[REJ_UNIFORM_MAX_BUFLEN];
+  int32_t r_ref[MLDSA_N], r_native[MLDSA_N];
+  unsigned int i, len, buflen, ctr_ref;
+  int ctr_native;
+
+  for (i = 0; i < NTESTS; i++)
+  {
+    randombytes(buf, sizeof(buf));
+    /* Force some rejections by setting the upper bits of some candidates */
+    buf[(i % (REJ_UNIFORM_MAX_BUFLEN / 3)) * 3 + 2] |= 0x7F;
+
+    /* Cover the full-length call as well as the short tails used when
+     * squeezing further blocks */
+    len = (i % 2 == 0) ? MLDSA_N : 1 + (i % MLDSA_N);
+    buflen = 3 * (1 + (i * 7) % (REJ_UNIFORM_MAX_BUFLEN / 3));
+
+    memset(r_ref, 0, sizeof(r_ref));
+    memset(r_native, 0, sizeof(r_native));
+    ctr_ref = rej_uniform_ref(r_ref, len, buf, buflen);
+    ctr_native = rej_uniform_native(r_native, len, buf, buflen);
+
+    if (ctr_native == MLD_NATIVE_FUNC_FALLBACK)
+    {
+      /* Native implementation does not support these lengths or the CPU */
+      continue;
+    }
+
+    CHECK((unsigned int)ctr_native == ctr_ref);
+    CHECK(memcmp(r_ref, r_native, ctr_ref * sizeof(int32_t)) == 0);
+  }
+
+  return 0;
+}
+#endif /* MLD_USE_NATIVE_REJ_UNIFORM */
+
+#if defined(MLD_USE_NATIVE_POLYETA_PACK) ||   \
+    defined(MLD_USE_NATIVE_POLYETA_UNPACK) || \
+    defined(MLD_USE_NATIVE_POLYT1_PACK) ||    \
+    defined(MLD_USE_NATIVE_POLYT1_UNPACK) ||  \
+    defined(MLD_USE_NATIVE_POLYT0_PACK) ||    \
+    defined(MLD_USE_NATIVE_POLYT0_UNPACK) ||  \
+    defined(MLD_USE_NATIVE_POLYZ_PACK) ||     \
+    defined(MLD_USE_NATIVE_POLYZ_UNPACK) || defined(MLD_USE_NATIVE_POLYW1_PACK)
+#define TEST_POLY_PACK
+#endif
+
+#if defined(TEST_POLY_PACK)
+
+/*
+ * Bit-packing formats, see the C implementations in mldsa/poly.c.
+ * Coefficient c is stored as the bits-bit value offset + sign * c, with
+ * coefficient i occupying bits i * bits, ..., (i + 1) * bits - 1 of the
+ * packed little-endian byte string.
+ */
+typedef struct
+{
+  unsigned int bits;
+  int32_t offset;
+  int32_t sign;
+  int32_t min, max; /* Range of valid coefficients */
+} pack_format;
+
+#define PACK_MAX_BYTES (MLDSA_N * 20 / 8)
+#define PACK_GUARD 32
+
+static void pack_ref(uint8_t *r, const int32_t a[MLDSA_N],
+                     const pack_format *fmt)
+{
+  unsigned int i, j, pos;
+  uint32_t t;
+
+  memset(r, 0, MLDSA_N * fmt->bits / 8);
+  for (i = 0; i < MLDSA_N; i++)
+  {
+    t = (uint32_t)(fmt->offset + fmt->sign * a[i]);
+    for (j = 0; j < fmt->bits; j++)
+    {
+      pos = i * fmt->bits + j;
+      r[pos / 8] |= (uint8_t)(((t >> j) & 1) << (pos % 8));
+    }
+  }
+}
+
+static void unpack_ref(int32_t r[MLDSA_N], const uint8_t *a,
+                       const pack_format *fmt)
+{
+  unsigned int i, j, pos;
+  uint32_t t;
+
+  for (i = 0; i < MLDSA_N; i++)
+  {
+    t = 0;
+    for (j = 0; j < fmt->bits; j++)
+    {
+      pos = i * fmt->bits + j;
+      t |= (uint32_t)((a[pos / 8] >> (pos % 8)) & 1) << j;
+    }
+    r[i] = fmt->sign * ((int32_t)t - fmt->offset);
+  }
+}
+
+/*
+ * Compares native packing and unpacking against the reference on random
+ * inputs, checks that they round-trip, and that the native packing does
+ * not write outside the packed polynomial. Either function may be NULL.
+ */
+static int test_pack_native(int (*pack)(uint8_t *, const int32_t *),
+                            int (*unpack)(int32_t *, const uint8_t *),
+                            const pack_format *fmt)
+{
+  uint8_t buf[PACK_GUARD + PACK_MAX_BYTES + PACK_GUARD];
+  uint8_t r_ref[PACK_MAX_BYTES];
+  uint8_t *r_native = buf + PACK_GUARD;
+  int32_t a[MLDSA_N], a_ref[MLDSA_N], a_native[MLDSA_N];
+  unsigned int i, j, nbytes;
+  uint32_t t;
+
+  nbytes = MLDSA_N * fmt->bits / 8;
+  for (i = 0; i < NTESTS; i++)
+  {
+    for (j = 0; j < MLDSA_N; j++)
+    {
+      randombytes((uint8_t *)&t, sizeof(t));
+      a[j] = fmt->min + (int32_t)(t % (uint32_t)(fmt->max - fmt->min + 1));
+    }
+    /* Include the extreme values */
+    a[i % MLDSA_N] = fmt->min;
+    a[(i + 1) % MLDSA_N] = fmt->max;
+
+    pack_ref(r_ref, a, fmt);
+    if (pack != NULL)
+    {
+      memset(buf, 0xA5, sizeof(buf));
+      if (pack(r_native, a) != MLD_NATIVE_FUNC_SUCCESS)
+      {
+        printf("Native packing not supported by this CPU, skipped\n");
+        return 0;
+      }
+      CHECK(memcmp(r_native, r_ref, nbytes) == 0);
+      for (j = 0; j < PACK_GUARD; j++)
+      {
+        CHECK(buf[j] == 0xA5);
+        CHECK(r_native[nbytes + j] == 0xA5);
+      }
+    }
+
+    if (unpack != NULL)
+    {
+      /* Round trip */
+      if (unpack(a_native, r_ref) != MLD_NATIVE_FUNC_SUCCESS)
+      {
+        printf("Native unpacking not supported by this CPU, skipped\n");
+        return 0;
+      }
+      CHECK(memcmp(a_native, a, sizeof(a)) == 0);
+
+      /* Arbitrary input, including invalid encodings */
+      randombytes(r_ref, nbytes);
+      unpack_ref(a_ref, r_ref, fmt);
+      CHECK(unpack(a_native, r_ref) == MLD_NATIVE_FUNC_SUCCESS);
+      CHECK(memcmp(a_native, a_ref, sizeof(a)) == 0);
+    }
+  }
+
+  return 0;
+}
+
+static int test_poly_pack_native(void)
+{
+  int r = 0;
+  const pack_format eta = {MLDSA_ETA == 2 ? 3 : 4, MLDSA_ETA, -1, -MLDSA_ETA,
+                           MLDSA_ETA};
+  const pack_format t1 = {10, 0, 1, 0, (1 << 10) - 1};
+  const pack_format t0 = {MLDSA_D, 1 << (MLDSA_D - 1), -1,
+                          -(1 << (MLDSA_D - 1)) + 1, 1 << (MLDSA_D - 1)};
+  const pack_format z = {MLDSA_MODE == 2 ? 18 : 20, MLDSA_GAMMA1, -1,
+                         -(MLDSA_GAMMA1 - 1), MLDSA_GAMMA1};
+  const pack_format w1 = {MLDSA_MODE == 2 ? 6 : 4, 0, 1, 0,
+                          (MLDSA_Q - 1) / (2 * MLDSA_GAMMA2) - 1};
+
+#if defined(MLD_USE_NATIVE_POLYETA_PACK) && \
+    defined(MLD_USE_NATIVE_POLYETA_UNPACK)
+  r |= test_pack_native(polyeta_pack_native, polyeta_unpack_native, &eta);
+#endif
+#if defined(MLD_USE_NATIVE_POLYT1_PACK) && defined(MLD_USE_NATIVE_POLYT1_UNPACK)
+  r |= test_pack_native(polyt1_pack_native, polyt1_unpack_native, &t1);
+#endif
+#if defined(MLD_USE_NATIVE_POLYT0_PACK) && defined(MLD_USE_NATIVE_POLYT0_UNPACK)
+  r |= test_pack_native(polyt0_pack_native, polyt0_unpack_native, &t0);
+#endif
+#if defined(MLD_USE_NATIVE_POLYZ_PACK) && defined(MLD_USE_NATIVE_POLYZ_UNPACK)
+  r |= test_pack_native(polyz_pack_native, polyz_unpack_native, &z);
+#endif
+#if defined(MLD_USE_NATIVE_POLYW1_PACK)
+  r |= test_pack_native(polyw1_pack_native, NULL, &w1);
+#endif
+
+  (void)eta;
+  (void)t1;
+  (void)t0;
+  (void)z;
+  (void)w1;
+  return r;
+}
+#endif /* TEST_POLY_PACK */
+
+/* The 4-way permutation against four scalar permutations */
+static int test_keccakf1600x4(void)
+{
+  uint64_t s[KECCAK_LANES * KECCAK_WAY];
+  uint64_t ref[KECCAK_WAY][KECCAK_LANES];
+  unsigned int i, j, l;
+
+  for (i = 0; i < NTESTS; i++)
+  {
+    randombytes((uint8_t *)ref, sizeof(ref));
+    for (l = 0; l < KECCAK_WAY; l++)
+    {
+      for (j = 0; j < KECCAK_LANES; j++)
+      {
+        s[KECCAK_WAY * j + l] = ref[l][j];
+      }
+    }
+
+    KeccakF1600x4_StatePermute(s);
+    for (l = 0; l < KECCAK_WAY; l++)
+    {
+      KeccakF1600_StatePermute(ref[l]);
+      for (j = 0; j < KECCAK_LANES; j++)
+      {
+        CHECK(s[KECCAK_WAY * j + l] == ref[l][j]);
+      }
+    }
+  }
+
+  return 0;
+}
+
+#define SHAKEX4_MAX_INLEN (3 * SHAKE128_RATE + 1)
+#define SHAKEX4_MAX_NBLOCKS 3
+
+/*
+ * 4-way SHAKE128 and SHAKE256 against four scalar calls on distinct
+ * inputs, for input lengths up to several blocks, including the empty
+ * input and lengths around the rates, and for squeezes split over two
+ * calls.
+ */
+static int test_shakex4(void)
+{
+  uint8_t in[4][SHAKEX4_MAX_INLEN];
+  uint8_t out[4][(SHAKEX4_MAX_NBLOCKS + 1) * SHAKE128_RATE];
+  uint8_t ref[(SHAKEX4_MAX_NBLOCKS + 1) * SHAKE128_RATE];
+  keccakx4_state state;
+  size_t inlen, nblocks;
+  unsigned int i, l;
+
+  for (i = 0; i <= SHAKEX4_MAX_INLEN; i++)
+  {
+    randombytes((uint8_t *)in, sizeof(in));
+    inlen = i;
+    nblocks = 1 + i % SHAKEX4_MAX_NBLOCKS;
+
+    shake128x4_absorb_once(&state, in[0], in[1], in[2], in[3], inlen);
+    shake128x4_squeezeblocks(out[0], out[1], out[2], out[3], nblocks,
+                             &state);
+    shake128x4_squeezeblocks(out[0] + nblocks * SHAKE128_RATE,
+                             out[1] + nblocks * SHAKE128_RATE,
+                             out[2] + nblocks * SHAKE128_RATE,
+                             out[3] + nblocks * SHAKE128_RATE, 1, &state);
+    for (l = 0; l < 4; l++)
+    {
+      shake128(ref, (nblocks + 1) * SHAKE128_RATE, in[l], inlen);
+      CHECK(memcmp(out[l], ref, (nblocks + 1) * SHAKE128_RATE) == 0);
+    }
+
+    shake256x4_absorb_once(&state, in[0], in[1], in[2], in[3], inlen);
+    shake256x4_squeezeblocks(out[0], out[1], out[2], out[3], nblocks,
+                             &state);
+    shake256x4_squeezeblocks(out[0] + nblocks * SHAKE256_RATE,
+                             out[1] + nblocks * SHAKE256_RATE,
+                             out[2] + nblocks * SHAKE256_RATE,
+                             out[3] + nblocks * SHAKE256_RATE, 1, &state);
+    for (l = 0; l < 4; l++)
+    {
+      shake256(ref, (nblocks + 1) * SHAKE256_RATE, in[l], inlen);
+      CHECK(memcmp(out[l], ref, (nblocks + 1) * SHAKE256_RATE) == 0);
+    }
+  }
+
+  return 0;
+}
+
+#define INCREMENTAL_MAX_LEN (3 * SHAKE128_RATE + 1)
+#define INCREMENTAL_NTESTS 200
+
+/* Returns a random length in [0, max] */
+static size_t random_len(size_t max)
+{
+  uint16_t r;
+  randombytes((uint8_t *)&r, sizeof(r));
+  return r % (max + 1);
+}
+
+/*
+ * Absorb a random message and squeeze the output in randomly sized
+ * chunks, including empty ones, and compare against the one-shot
+ * shake128 and shake256.
+ */
+static int test_shake_incremental(void)
+{
+  uint8_t in[INCREMENTAL_MAX_LEN];
+  uint8_t out[INCREMENTAL_MAX_LEN];
+  uint8_t ref[INCREMENTAL_MAX_LEN];
+  keccak_state state;
+  size_t inlen, outlen, pos, chunk;
+  unsigned int i;
+
+  for (i = 0; i < INCREMENTAL_NTESTS; i++)
+  {
+    randombytes(in, sizeof(in));
+    inlen = random_len(INCREMENTAL_MAX_LEN);
+    outlen = random_len(INCREMENTAL_MAX_LEN);
+
+    shake128_init(&state);
+    for (pos = 0; pos < inlen; pos += chunk)
+    {
+      chunk = random_len(inlen - pos);
+      shake128_absorb(&state, in + pos, chunk);
+    }
+    shake128_finalize(&state);
+    for (pos = 0; pos < outlen; pos += chunk)
+    {
+      chunk = random_len(outlen - pos);
+      shake128_squeeze(out + pos, chunk, &state);
+    }
+    shake128(ref, outlen, in, inlen);
+    CHECK(memcmp(out, ref, outlen) == 0);
+
+    shake256_init(&state);
+    for (pos = 0; pos < inlen; pos += chunk)
+    {
+      chunk = random_len(inlen - pos);
+      shake256_absorb(&state, in + pos, chunk);
+    }
+    shake256_finalize(&state);
+    for (pos = 0; pos < outlen; pos += chunk)
+    {
+      chunk = random_len(outlen - pos);
+      shake256_squeeze(out + pos, chunk, &state);
+    }
+    shake256(ref, outlen, in, inlen);
+    CHECK(memcmp(out, ref, outlen) == 0);
+  }
+
+  return 0;
+}
+
+#define CLONE_MAX_LEN (2 * SHAKE256_RATE + 1)
+#define CLONE_OUTLEN (SHAKE256_RATE + 1)
+
+/*
+ * Clone an absorbing SHAKE256 state after a common prefix, continue the
+ * original and the copy with different suffixes and compare against
+ * hashing both full messages independently.
+ */
+static int test_shake256_clone(void)
+{
+  uint8_t msg[2][2 * CLONE_MAX_LEN];
+  uint8_t out[2][CLONE_OUTLEN];
+  uint8_t ref[CLONE_OUTLEN];
+  keccak_state state[2];
+  size_t plen, slen[2];
+  unsigned int i, k;
+
+  for (i = 0; i <= CLONE_MAX_LEN; i++)
+  {
+    randombytes((uint8_t *)msg, sizeof(msg));
+    plen = i;
+    slen[0] = (7 * i) % CLONE_MAX_LEN;
+    slen[1] = (11 * i + 3) % CLONE_MAX_LEN;
+    memcpy(msg[1], msg[0], plen);
+
+    shake256_init(&state[0]);
+    shake256_absorb(&state[0], msg[0], plen);
+    shake256_clone(&state[1], &state[0]);
+    for (k = 0; k < 2; k++)
+    {
+      shake256_absorb(&state[k], msg[k] + plen, slen[k]);
+      shake256_finalize(&state[k]);
+      shake256_squeeze(out[k], CLONE_OUTLEN, &state[k]);
+    }
+
+    for (k = 0; k < 2; k++)
+    {
+      shake256(ref, CLONE_OUTLEN, msg[k], plen + slen[k]);
+      CHECK(memcmp(out[k], ref, CLONE_OUTLEN) == 0);
+    }
+  }
+
+  return 0;
+}
+
+#if !defined(MLD_CONFIG_NO_CAPS_ENV) && !defined(_WIN32)
+/* Sets or, if env is NULL, unsets MLD_DISABLE_CAPS and redetects the
+ * capabilities */
+static int caps_with_env(const char *env)
+{
+  if (env == NULL)
+  {
+    unsetenv("MLD_DISABLE_CAPS");
+  }
+  else
+  {
+    setenv("MLD_DISABLE_CAPS", env, 1);
+  }
+  mld_init();
+  return mld_sys_caps_load();
+}
+
+/* Parsing of MLD_DISABLE_CAPS by mld_init() */
+static int test_caps_env(void)
+{
+  char saved[64] = {0};
+  const char *env = getenv("MLD_DISABLE_CAPS");
+  int caps, r = 0;
+
+  if (env != NULL)
+  {
+    strncpy(saved, env, sizeof(saved) - 1);
+  }
+
+  caps = caps_with_env(NULL);
+  r |= caps < 0;
+  r |= caps_with_env("all") != 0;
+  r |= caps_with_env("avx2") != (caps & ~(int)MLD_SYS_CAP_AVX2);
+  r |= caps_with_env("sse,avx2") != (caps & ~(int)MLD_SYS_CAP_AVX2);
+  r |= caps_with_env("") != caps;
+  r |= caps_with_env("none") != caps;
+
+  caps_with_env(env != NULL ? saved : NULL);
+  CHECK(r == 0);
+  return 0;
+}
+#endif /* !MLD_CONFIG_NO_CAPS_ENV && !_WIN32 */
+
+#define FALLBACK_NTESTS 10
+#define FALLBACK_MLEN 59
+
+/*
+ * Forces the fallback to the C code by disabling all capabilities, and
+ * checks that the native functions report the fallback, and that key
+ * generation, signing and verification, which use all native functions,
+ * give the same results as with the capabilities of this CPU.
+ */
+static int test_fallback(void)
+{
+  uint8_t seed[MLDSA_SEEDBYTES];
+  uint8_t rnd[MLDSA_RNDBYTES];
+  uint8_t m[FALLBACK_MLEN];
+  const uint8_t pre[2] = {0, 0};
+  uint8_t pk[2][CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[2][CRYPTO_SECRETKEYBYTES];
+  uint8_t sig[2][CRYPTO_BYTES];
+  int32_t a[MLDSA_N], a_copy[MLDSA_N];
+  uint8_t buf[3 * MLDSA_N];
+  size_t siglen;
+  unsigned int i, k;
+  int caps, r = 0;
+
+  mld_init();
+  caps = mld_sys_caps_load();
+
+  for (i = 0; i < FALLBACK_NTESTS; i++)
+  {
+    randombytes(seed, sizeof(seed));
+    randombytes(rnd, sizeof(rnd));
+    randombytes(m, sizeof(m));
+
+    for (k = 0; k < 2; k++)
+    {
+      mld_sys_caps_store(k == 0 ? caps : 0);
+      r |= crypto_sign_keypair_internal(pk[k], sk[k], seed);
+      r |= crypto_sign_signature_internal(sig[k], &siglen, m, sizeof(m), pre,
+                                          sizeof(pre), rnd, sk[k], 0);
+    }
+    r |= memcmp(pk[0], pk[1], CRYPTO_PUBLICKEYBYTES) != 0;
+    r |= memcmp(sk[0], sk[1], CRYPTO_SECRETKEYBYTES) != 0;
+    r |= memcmp(sig[0], sig[1], CRYPTO_BYTES) != 0;
+    /* Capabilities are disabled: verify with the C code only */
+    r |= crypto_sign_verify_internal(sig[0], CRYPTO_BYTES, m, sizeof(m), pre,
+                                     sizeof(pre), pk[0], 0);
+  }
+
+  /* Capabilities are still disabled */
+  randombytes((uint8_t *)a, sizeof(a));
+  randombytes(buf, sizeof(buf));
+  memcpy(a_copy, a, sizeof(a));
+#if defined(MLD_USE_NATIVE_NTT)
+  r |= ntt_native(a) != MLD_NATIVE_FUNC_FALLBACK;
+#endif
+#if defined(MLD_USE_NATIVE_INTT)
+  r |= intt_native(a) != MLD_NATIVE_FUNC_FALLBACK;
+#endif
+#if defined(MLD_USE_NATIVE_REJ_UNIFORM)
+  r |= rej_uniform_native(a, MLDSA_N, buf, sizeof(buf)) !=
+       MLD_NATIVE_FUNC_FALLBACK;
+#endif
+#if defined(MLD_USE_NATIVE_POLYETA_UNPACK)
+  r |= polyeta_unpack_native(a, buf) != MLD_NATIVE_FUNC_FALLBACK;
+#endif
+#if defined(MLD_USE_NATIVE_POLYT1_UNPACK)
+  r |= polyt1_unpack_native(a, buf) != MLD_NATIVE_FUNC_FALLBACK;
+#endif
+#if defined(MLD_USE_NATIVE_POLYT0_UNPACK)
+  r |= polyt0_unpack_native(a, buf) != MLD_NATIVE_FUNC_FALLBACK;
+#endif
+#if defined(MLD_USE_NATIVE_POLYZ_UNPACK)
+  r |= polyz_unpack_native(a, buf) != MLD_NATIVE_FUNC_FALLBACK;
+#endif
+  /* Falling back leaves the output untouched */
+  r |= memcmp(a, a_copy, sizeof(a)) != 0;
+
+  /* The 4-way Keccak without its native backend */
+  r |= test_keccakf1600x4();
+
+  mld_sys_caps_store(caps);
+  CHECK(r == 0);
+  return 0;
+}
+
+int main(void)
+{
+  int r = 0;
+
+  /* WARNING: Test-only
+   * Normally, you would want to seed a PRNG with trustworthy entropy here. */
+  randombytes_reset();
+
+#if defined(MLD_USE_NATIVE_NTT)
+  r |= test_ntt_native();
+#endif
+#if defined(MLD_USE_NATIVE_INTT)
+  r |= test_intt_native();
+#endif
+#if defined(MLD_USE_NATIVE_REJ_UNIFORM)
+  r |= test_rej_uniform_native();
+#endif
+#if defined(TEST_POLY_PACK)
+  r |= test_poly_pack_native();
+#endif
+  r |= test_keccakf1600x4();
+  r |= test_shakex4();
+  r |= test_shake_incremental();
+  r |= test_shake256_clone();
+#if !defined(MLD_CONFIG_NO_CAPS_ENV) && !defined(_WIN32)
+  r |= test_caps_env();
+#endif
+  r |= test_fallback();
+
+  if (r)
+  {
+    return 1;
+  }
+
+  printf("Unit tests passed\n");
+  return 0;
+}